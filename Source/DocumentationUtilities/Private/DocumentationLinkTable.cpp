@@ -0,0 +1,381 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "DocumentationLinkTable.h"
+
+#include <Async/MappedFileHandle.h>
+#include <HAL/PlatformFileManager.h>
+#include <Misc/FileHelper.h>
+#include <Misc/Paths.h>
+
+
+
+struct FDocumentationLinkTable::FHeader
+{
+	uint32 Magic;
+	uint32 Version;
+	uint32 NumEntries;
+	uint32 DisplacementsOffset;
+	uint32 EntriesOffset;
+	uint32 PoolOffset;
+	uint32 PoolSize;
+};
+
+struct FDocumentationLinkTable::FEntry
+{
+	uint32 KeyOffset;
+	uint32 KeyLength;
+	uint32 ValueOffset;
+	uint32 ValueLength;
+};
+
+namespace DocumentationLinkTable
+{
+	static constexpr uint32 Magic = 0x544C5544; // 'DULT'
+	static constexpr uint32 Version = 1;
+	static constexpr uint32 FNVPrime = 0x01000193;
+
+	/** Lowercase ASCII, UTF-8 bytes. Same stream is hashed on write and on lookup */
+	template<typename VisitorType>
+	static void ForEachKeyByte(FStringView Key, VisitorType&& Visitor)
+	{
+		for (int32 Index = 0; Index < Key.Len(); Index++)
+		{
+			uint32 Code = (uint32)Key[Index];
+			if (Code < 0x80)
+			{
+				Visitor((uint8)FChar::ToLower((TCHAR)Code));
+				continue;
+			}
+
+			if (sizeof(TCHAR) == 2 && Code >= 0xD800 && Code <= 0xDBFF && Index + 1 < Key.Len())
+			{
+				const uint32 Low = (uint32)Key[Index + 1];
+				if (Low >= 0xDC00 && Low <= 0xDFFF)
+				{
+					Code = 0x10000 + ((Code - 0xD800) << 10) + (Low - 0xDC00);
+					Index++;
+				}
+			}
+
+			if (Code < 0x800)
+			{
+				Visitor((uint8)(0xC0 | (Code >> 6)));
+			}
+			else if (Code < 0x10000)
+			{
+				Visitor((uint8)(0xE0 | (Code >> 12)));
+				Visitor((uint8)(0x80 | ((Code >> 6) & 0x3F)));
+			}
+			else
+			{
+				Visitor((uint8)(0xF0 | (Code >> 18)));
+				Visitor((uint8)(0x80 | ((Code >> 12) & 0x3F)));
+				Visitor((uint8)(0x80 | ((Code >> 6) & 0x3F)));
+			}
+			Visitor((uint8)(0x80 | (Code & 0x3F)));
+		}
+	}
+
+	static uint32 HashKey(uint32 Seed, FStringView Key)
+	{
+		uint32 Hash = Seed != 0 ? Seed : FNVPrime;
+		ForEachKeyByte(Key, [&Hash](uint8 Byte)
+		{
+			Hash = (Hash * FNVPrime) ^ Byte;
+		});
+		return Hash;
+	}
+
+	/** Displacement < 0 stores slot of single key bucket directly */
+	static uint32 GetSlot(int32 Displacement, FStringView Key, uint32 NumEntries)
+	{
+		return Displacement < 0 ? (uint32)(-Displacement - 1) : HashKey((uint32)Displacement, Key) % NumEntries;
+	}
+}
+
+
+
+const FDocumentationLinkTable& FDocumentationLinkTable::Get()
+{
+	static FDocumentationLinkTable Table;
+	static const bool bLoaded = Table.Load(GetDefaultPath());
+	(void)bLoaded;
+	return Table;
+}
+
+FString FDocumentationLinkTable::GetDefaultPath()
+{
+	return FPaths::ProjectContentDir() / TEXT("DocumentationUtilities") / TEXT("LinkTable.bin");
+}
+
+FDocumentationLinkTable::FDocumentationLinkTable() = default;
+
+FDocumentationLinkTable::~FDocumentationLinkTable()
+{
+	Unload();
+}
+
+bool FDocumentationLinkTable::Load(const FString& Path)
+{
+	Unload();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.FileExists(*Path))
+	{
+		return false;
+	}
+
+	int64 Size = 0;
+	MappedHandle = PlatformFile.OpenMapped(*Path);
+	if (MappedHandle)
+	{
+		MappedRegion = MappedHandle->MapRegion();
+		if (MappedRegion)
+		{
+			Data = MappedRegion->GetMappedPtr();
+			Size = MappedRegion->GetMappedSize();
+		}
+	}
+
+	if (Data == nullptr)
+	{
+		Unload();
+		if (!FFileHelper::LoadFileToArray(LoadedBytes, *Path, FILEREAD_Silent))
+		{
+			return false;
+		}
+		Data = LoadedBytes.GetData();
+		Size = LoadedBytes.Num();
+	}
+
+	if (!Validate(Size))
+	{
+		Unload();
+		return false;
+	}
+	return true;
+}
+
+void FDocumentationLinkTable::Unload()
+{
+	Data = nullptr;
+
+	delete MappedRegion;
+	MappedRegion = nullptr;
+
+	delete MappedHandle;
+	MappedHandle = nullptr;
+
+	LoadedBytes.Empty();
+}
+
+const FDocumentationLinkTable::FHeader* FDocumentationLinkTable::GetHeader() const
+{
+	return reinterpret_cast<const FHeader*>(Data);
+}
+
+bool FDocumentationLinkTable::Validate(int64 Size) const
+{
+	if (Data == nullptr || Size < (int64)sizeof(FHeader))
+	{
+		return false;
+	}
+
+	const FHeader& Header = *GetHeader();
+	if (Header.Magic != DocumentationLinkTable::Magic || Header.Version != DocumentationLinkTable::Version)
+	{
+		return false;
+	}
+
+	const int64 DisplacementsEnd = (int64)Header.DisplacementsOffset + (int64)Header.NumEntries * sizeof(int32);
+	const int64 EntriesEnd = (int64)Header.EntriesOffset + (int64)Header.NumEntries * sizeof(FEntry);
+	const int64 PoolEnd = (int64)Header.PoolOffset + Header.PoolSize;
+	if (DisplacementsEnd > Size || EntriesEnd > Size || PoolEnd > Size
+		|| !IsAligned(Header.DisplacementsOffset, alignof(int32)) || !IsAligned(Header.EntriesOffset, alignof(FEntry)))
+	{
+		return false;
+	}
+
+	// Checked once here so lookups can trust offsets
+	const FEntry* Entries = reinterpret_cast<const FEntry*>(Data + Header.EntriesOffset);
+	for (uint32 Index = 0; Index < Header.NumEntries; Index++)
+	{
+		const FEntry& Entry = Entries[Index];
+		if ((uint64)Entry.KeyOffset + Entry.KeyLength > Header.PoolSize || (uint64)Entry.ValueOffset + Entry.ValueLength > Header.PoolSize)
+		{
+			return false;
+		}
+	}
+
+	// Negative displacement is direct slot index, lookups use it without bounds check
+	const int32* Displacements = reinterpret_cast<const int32*>(Data + Header.DisplacementsOffset);
+	for (uint32 Index = 0; Index < Header.NumEntries; Index++)
+	{
+		const int32 Displacement = Displacements[Index];
+		if (Displacement < 0 && -(int64)Displacement - 1 >= (int64)Header.NumEntries)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+int32 FDocumentationLinkTable::Num() const
+{
+	return Data ? (int32)GetHeader()->NumEntries : 0;
+}
+
+FUtf8StringView FDocumentationLinkTable::Find(FStringView Key) const
+{
+	if (Data == nullptr || GetHeader()->NumEntries == 0)
+	{
+		return FUtf8StringView();
+	}
+
+	const FHeader& Header = *GetHeader();
+	const int32* Displacements = reinterpret_cast<const int32*>(Data + Header.DisplacementsOffset);
+	const FEntry* Entries = reinterpret_cast<const FEntry*>(Data + Header.EntriesOffset);
+	const uint8* Pool = Data + Header.PoolOffset;
+
+	const uint32 Bucket = DocumentationLinkTable::HashKey(0, Key) % Header.NumEntries;
+	const uint32 Slot = DocumentationLinkTable::GetSlot(Displacements[Bucket], Key, Header.NumEntries);
+	const FEntry& Entry = Entries[Slot];
+
+	// Perfect hash maps unknown keys to some slot too, compare stored key
+	const uint8* StoredKey = Pool + Entry.KeyOffset;
+	uint32 Position = 0;
+	bool bEqual = true;
+	DocumentationLinkTable::ForEachKeyByte(Key, [&](uint8 Byte)
+	{
+		bEqual = bEqual && Position < Entry.KeyLength && StoredKey[Position] == Byte;
+		Position++;
+	});
+
+	if (!bEqual || Position != Entry.KeyLength)
+	{
+		return FUtf8StringView();
+	}
+	return FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Pool + Entry.ValueOffset), Entry.ValueLength);
+}
+
+bool FDocumentationLinkTable::Find(FStringView Key, FString& OutAddress) const
+{
+	const FUtf8StringView Address = Find(Key);
+	if (Address.IsEmpty())
+	{
+		return false;
+	}
+	OutAddress = FString(Address);
+	return true;
+}
+
+void FDocumentationLinkTable::Write(const TMap<FString, FString>& Links, TArray<uint8>& OutBlob)
+{
+	using namespace DocumentationLinkTable;
+
+	TArray<FString> Keys;
+	Links.GenerateKeyArray(Keys);
+	Keys.Sort();
+
+	const uint32 NumEntries = Keys.Num();
+
+	// Hash and displace: group keys by first hash, place large buckets first with seed that gives free slots
+	TArray<TArray<int32>> Buckets;
+	Buckets.SetNum(NumEntries);
+	for (int32 KeyIndex = 0; KeyIndex < Keys.Num(); KeyIndex++)
+	{
+		Buckets[HashKey(0, Keys[KeyIndex]) % NumEntries].Add(KeyIndex);
+	}
+
+	TArray<int32> BucketOrder;
+	for (int32 Bucket = 0; Bucket < Buckets.Num(); Bucket++)
+	{
+		BucketOrder.Add(Bucket);
+	}
+	BucketOrder.StableSort([&Buckets](int32 A, int32 B) { return Buckets[A].Num() > Buckets[B].Num(); });
+
+	TArray<int32> Displacements;
+	Displacements.SetNumZeroed(NumEntries);
+
+	TArray<int32> SlotKeys;
+	SlotKeys.Init(INDEX_NONE, NumEntries);
+
+	TArray<uint32> TrySlots;
+	int32 OrderIndex = 0;
+	for (; OrderIndex < BucketOrder.Num() && Buckets[BucketOrder[OrderIndex]].Num() > 1; OrderIndex++)
+	{
+		const TArray<int32>& BucketKeys = Buckets[BucketOrder[OrderIndex]];
+		for (int32 Seed = 1; ; Seed++)
+		{
+			TrySlots.Reset();
+			bool bFits = true;
+			for (int32 KeyIndex : BucketKeys)
+			{
+				const uint32 Slot = HashKey(Seed, Keys[KeyIndex]) % NumEntries;
+				if (SlotKeys[Slot] != INDEX_NONE || TrySlots.Contains(Slot))
+				{
+					bFits = false;
+					break;
+				}
+				TrySlots.Add(Slot);
+			}
+
+			if (bFits)
+			{
+				Displacements[BucketOrder[OrderIndex]] = Seed;
+				for (int32 Index = 0; Index < BucketKeys.Num(); Index++)
+				{
+					SlotKeys[TrySlots[Index]] = BucketKeys[Index];
+				}
+				break;
+			}
+		}
+	}
+
+	// Single key buckets take remaining slots directly
+	int32 FreeSlot = 0;
+	for (; OrderIndex < BucketOrder.Num() && Buckets[BucketOrder[OrderIndex]].Num() == 1; OrderIndex++)
+	{
+		while (SlotKeys[FreeSlot] != INDEX_NONE)
+		{
+			FreeSlot++;
+		}
+		SlotKeys[FreeSlot] = Buckets[BucketOrder[OrderIndex]][0];
+		Displacements[BucketOrder[OrderIndex]] = -FreeSlot - 1;
+	}
+
+	// String pool
+	TArray<uint8> Pool;
+	TArray<FEntry> Entries;
+	Entries.SetNumZeroed(NumEntries);
+	for (uint32 Slot = 0; Slot < NumEntries; Slot++)
+	{
+		const FString& Key = Keys[SlotKeys[Slot]];
+		FEntry& Entry = Entries[Slot];
+
+		Entry.KeyOffset = Pool.Num();
+		ForEachKeyByte(Key, [&Pool](uint8 Byte) { Pool.Add(Byte); });
+		Entry.KeyLength = Pool.Num() - Entry.KeyOffset;
+
+		FTCHARToUTF8 Value(*Links.FindChecked(Key));
+		Entry.ValueOffset = Pool.Num();
+		Entry.ValueLength = Value.Length();
+		Pool.Append(reinterpret_cast<const uint8*>(Value.Get()), Value.Length());
+	}
+
+	FHeader Header;
+	Header.Magic = Magic;
+	Header.Version = Version;
+	Header.NumEntries = NumEntries;
+	Header.DisplacementsOffset = (uint32)Align(sizeof(FHeader), alignof(int32));
+	Header.EntriesOffset = (uint32)Align(Header.DisplacementsOffset + NumEntries * sizeof(int32), alignof(FEntry));
+	Header.PoolOffset = (uint32)(Header.EntriesOffset + NumEntries * sizeof(FEntry));
+	Header.PoolSize = Pool.Num();
+
+	OutBlob.Reset();
+	OutBlob.SetNumZeroed(Header.PoolOffset + Header.PoolSize);
+	FMemory::Memcpy(OutBlob.GetData(), &Header, sizeof(FHeader));
+	FMemory::Memcpy(OutBlob.GetData() + Header.DisplacementsOffset, Displacements.GetData(), NumEntries * sizeof(int32));
+	FMemory::Memcpy(OutBlob.GetData() + Header.EntriesOffset, Entries.GetData(), NumEntries * sizeof(FEntry));
+	FMemory::Memcpy(OutBlob.GetData() + Header.PoolOffset, Pool.GetData(), Pool.Num());
+}
@@ -0,0 +1,76 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "DocumentationNativeLinks.h"
+
+
+
+namespace DocumentationNativeLinks
+{
+	/** Function statics are constant initialized, safe to use from other modules static init */
+	static FDocumentationNativeLink*& GetLinksHead()
+	{
+		static FDocumentationNativeLink* Head = nullptr;
+		return Head;
+	}
+
+	template<typename NodeType>
+	static void Unlink(NodeType*& Head, NodeType* Node)
+	{
+		for (NodeType** It = &Head; *It; It = &(*It)->Next)
+		{
+			if (*It == Node)
+			{
+				*It = Node->Next;
+				return;
+			}
+		}
+	}
+
+	static FDocumentationNativeLinkModule*& GetModulesHead()
+	{
+		static FDocumentationNativeLinkModule* Head = nullptr;
+		return Head;
+	}
+}
+
+FDocumentationNativeLink::FDocumentationNativeLink(const TCHAR* InModuleName, FGetType InGetType, const TCHAR* InAddress)
+	: ModuleName(InModuleName)
+	, GetType(InGetType)
+	, Address(InAddress)
+	, Next(DocumentationNativeLinks::GetLinksHead())
+{
+	DocumentationNativeLinks::GetLinksHead() = this;
+}
+
+FDocumentationNativeLink::~FDocumentationNativeLink()
+{
+	DocumentationNativeLinks::Unlink(DocumentationNativeLinks::GetLinksHead(), this);
+}
+
+void FDocumentationNativeLink::ForEach(TFunctionRef<void(const FDocumentationNativeLink& Link)> Visitor)
+{
+	for (const FDocumentationNativeLink* Link = DocumentationNativeLinks::GetLinksHead(); Link; Link = Link->Next)
+	{
+		Visitor(*Link);
+	}
+}
+
+FDocumentationNativeLinkModule::FDocumentationNativeLinkModule(const TCHAR* InModuleName)
+	: ModuleName(InModuleName)
+	, Next(DocumentationNativeLinks::GetModulesHead())
+{
+	DocumentationNativeLinks::GetModulesHead() = this;
+}
+
+FDocumentationNativeLinkModule::~FDocumentationNativeLinkModule()
+{
+	DocumentationNativeLinks::Unlink(DocumentationNativeLinks::GetModulesHead(), this);
+}
+
+void FDocumentationNativeLinkModule::ForEach(TFunctionRef<void(const FDocumentationNativeLinkModule& Module)> Visitor)
+{
+	for (const FDocumentationNativeLinkModule* Module = DocumentationNativeLinks::GetModulesHead(); Module; Module = Module->Next)
+	{
+		Visitor(*Module);
+	}
+}
@@ -0,0 +1,63 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * Resolved documentation links available in cooked builds
+ *
+ * Written by editor during cook when 'Cook Runtime Link Table' is enabled in settings
+ * Blob is memory mapped and used in place: UTF-8 string pool and minimal perfect hash over keys
+ * Lookup hashes key directly from TCHARs, no parsing or allocations
+ *
+ * Keys are case insensitive for ASCII, same as link keys in editor
+ */
+class DOCUMENTATIONUTILITIES_API FDocumentationLinkTable
+{
+public:
+	/** Table from default location, loaded on first use */
+	static const FDocumentationLinkTable& Get();
+
+	/** Content/DocumentationUtilities/LinkTable.bin */
+	static FString GetDefaultPath();
+
+	FDocumentationLinkTable();
+	~FDocumentationLinkTable();
+
+	UE_NONCOPYABLE(FDocumentationLinkTable);
+
+	/** Map file, falls back to reading it when platform can not map. Returns false if file is missing or invalid */
+	bool Load(const FString& Path);
+	void Unload();
+
+	bool IsLoaded() const { return Data != nullptr; }
+	int32 Num() const;
+
+	/** Address for key or empty view. View points into the mapped blob and lives as long as the table */
+	FUtf8StringView Find(FStringView Key) const;
+
+	/** Same as Find with conversion */
+	bool Find(FStringView Key, FString& OutAddress) const;
+
+	/** Build blob from resolved links. Used by cook, available in all builds */
+	static void Write(const TMap<FString, FString>& Links, TArray<uint8>& OutBlob);
+
+private:
+	struct FHeader;
+	struct FEntry;
+
+	const FHeader* GetHeader() const;
+	bool Validate(int64 Size) const;
+
+	const uint8* Data = nullptr;
+
+	IMappedFileHandle* MappedHandle = nullptr;
+	IMappedFileRegion* MappedRegion = nullptr;
+
+	/** Used when mapping is not supported */
+	TArray<uint8> LoadedBytes;
+};
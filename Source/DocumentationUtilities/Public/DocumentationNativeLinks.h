@@ -0,0 +1,83 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UObject;
+
+//
+// Native documentation links declared next to the type, collected at static init
+//
+// DOCUMENTATION_NATIVE_LINK(AMyActor, TEXT("https://example.com/docs/MyActor"))
+//
+// Key is the type path, same as FHintStruct().Link(Type), Address is final address such as URL, it is not resolved as link key
+// Links appear in 'Native Links' of documentation settings, value set in config takes priority
+// Both macros expand to nothing in builds without editor
+//
+// Module that registers all of its links this way can skip search for FHintStruct defaults in its types
+// DOCUMENTATION_NATIVE_LINKS_SKIP_SCAN()
+//
+
+
+/** Single registered link. Instances are static, unlinked when module is unloaded */
+struct DOCUMENTATIONUTILITIES_API FDocumentationNativeLink
+{
+	using FGetType = UObject* (*)();
+
+	/** Module that registered the link */
+	const TCHAR* ModuleName;
+
+	/** Type is not constructed yet during static init, resolved on demand */
+	FGetType GetType;
+
+	const TCHAR* Address;
+
+	FDocumentationNativeLink* Next;
+
+	FDocumentationNativeLink(const TCHAR* InModuleName, FGetType InGetType, const TCHAR* InAddress);
+	~FDocumentationNativeLink();
+
+	static void ForEach(TFunctionRef<void(const FDocumentationNativeLink& Link)> Visitor);
+
+	template<typename T>
+	static UObject* GetTypeObject()
+	{
+		if constexpr (TIsDerivedFrom<T, UObject>::Value)
+		{
+			return T::StaticClass();
+		}
+		else
+		{
+			return T::StaticStruct();
+		}
+	}
+};
+
+/** Module opted out of FHintStruct default scan */
+struct DOCUMENTATIONUTILITIES_API FDocumentationNativeLinkModule
+{
+	const TCHAR* ModuleName;
+	FDocumentationNativeLinkModule* Next;
+
+	explicit FDocumentationNativeLinkModule(const TCHAR* InModuleName);
+	~FDocumentationNativeLinkModule();
+
+	static void ForEach(TFunctionRef<void(const FDocumentationNativeLinkModule& Module)> Visitor);
+};
+
+
+#if WITH_EDITOR
+
+#define DOCUMENTATION_NATIVE_LINK(Type, Address) \
+	static const FDocumentationNativeLink PREPROCESSOR_JOIN(DocumentationNativeLink_, __COUNTER__)(TEXT(UE_MODULE_NAME), &FDocumentationNativeLink::GetTypeObject<Type>, Address);
+
+#define DOCUMENTATION_NATIVE_LINKS_SKIP_SCAN() \
+	static const FDocumentationNativeLinkModule PREPROCESSOR_JOIN(DocumentationNativeLinkModule_, __COUNTER__)(TEXT(UE_MODULE_NAME));
+
+#else
+
+#define DOCUMENTATION_NATIVE_LINK(Type, Address)
+#define DOCUMENTATION_NATIVE_LINKS_SKIP_SCAN()
+
+#endif
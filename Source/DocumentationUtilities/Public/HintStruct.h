@@ -61,6 +61,7 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Hint")
 	EHintSource HintSource;
 
+	/** {Property} is replaced with value of owner object property, {{ and }} are braces */
 	UPROPERTY(EditAnywhere, Category = "Hint", meta = (EditCondition = "HintSource == EHintSource::PropertyValue", EditConditionHides))
 	FString HintText;
 
@@ -68,6 +69,7 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Hint")
 	EHintSource TooltipSource;
 
+	/** {Property} is replaced with value of owner object property, {{ and }} are braces */
 	UPROPERTY(EditAnywhere, Category = "Hint", meta = (EditCondition = "TooltipSource == EHintSource::PropertyValue", EditConditionHides))
 	FString TooltipText;
 
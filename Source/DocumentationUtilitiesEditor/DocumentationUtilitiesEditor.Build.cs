@@ -27,11 +27,16 @@ public class DocumentationUtilitiesEditor : ModuleRules
                 "PropertyEditor",
 
 				"DeveloperSettings",
+				"DeveloperToolSettings",
 
                 "UnrealEd",
 				"ApplicationCore",
 				"ToolMenus",
-                "ContentBrowser"
+                "ContentBrowser",
+				"AssetRegistry",
+				"WorkspaceMenuStructure",
+				"LevelEditor",
+				"ClassViewer"
             }
 		);
 	}
@@ -0,0 +1,715 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "DocumentationExportCommandlet.h"
+#include "DocumentationUtilitiesSettings.h"
+#include "DocumentationLinkSchemes.h"
+#include "DocumentationHintUtils.h"
+#include "HintStruct.h"
+
+#include <AssetRegistry/AssetData.h>
+#include <AssetRegistry/AssetRegistryModule.h>
+#include <Async/ParallelFor.h>
+#include <HAL/FileManager.h>
+#include <IO/IoHash.h>
+#include <Misc/FileHelper.h>
+#include <Misc/PackageName.h>
+#include <Misc/Paths.h>
+#include <Misc/SecureHash.h>
+#include <Serialization/MemoryReader.h>
+#include <Serialization/MemoryWriter.h>
+#include <UObject/Package.h>
+#include <UObject/UObjectHash.h>
+
+#include <atomic>
+
+DEFINE_LOG_CATEGORY_STATIC(LogDocumentationExport, Log, All);
+
+
+
+namespace DocumentationExport
+{
+	static const TCHAR* ManifestName = TEXT(".manifest");
+	static const TCHAR* PackageManifestName = TEXT(".packages");
+	static constexpr int32 PackageManifestVersion = 1;
+
+	struct FEntry
+	{
+		FString Name;
+		FString Hint;
+		FString Tooltip;
+		FString Link;
+		FString Address;
+
+		/** Page of linked type or asset, empty if link leads outside of the site */
+		FString TargetPage;
+
+		/** Only collected data, address and target page are resolved on every run */
+		friend FArchive& operator<<(FArchive& Ar, FEntry& Entry)
+		{
+			return Ar << Entry.Name << Entry.Hint << Entry.Tooltip << Entry.Link;
+		}
+	};
+
+	struct FPage
+	{
+		FString Key;
+		FString Title;
+		FString Category;
+		FString FileName;
+		TArray<FEntry> Entries;
+
+		/** Package that owns asset or blueprint type of the page, None for native types */
+		FName Package;
+
+		friend FArchive& operator<<(FArchive& Ar, FPage& Page)
+		{
+			return Ar << Page.Key << Page.Title << Page.Category << Page.Entries;
+		}
+	};
+
+	/** Pages collected from hinted package when it had this hash, reused while package is unchanged */
+	struct FPackageEntry
+	{
+		FString Hash;
+		TArray<FPage> Pages;
+
+		friend FArchive& operator<<(FArchive& Ar, FPackageEntry& Entry)
+		{
+			return Ar << Entry.Hash << Entry.Pages;
+		}
+	};
+
+	using FPackageManifest = TMap<FName, FPackageEntry>;
+
+	struct FLinkRow
+	{
+		FString Key;
+		FString Address;
+		FString TargetPage;
+	};
+
+	/** Collected on game thread, read only while pages are rendered */
+	struct FSite
+	{
+		TArray<FPage> Pages;
+		TArray<FLinkRow> Links;
+		TMap<FString, int32> PageByKey;
+		bool bMarkdown = false;
+
+		const TCHAR* GetExtension() const { return bMarkdown ? TEXT(".md") : TEXT(".html"); }
+	};
+
+	static FString MakeFileName(const FString& Key, const FSite& Site, TSet<FString>& UsedNames)
+	{
+		FString Name;
+		Name.Reserve(Key.Len());
+		for (TCHAR Char : Key)
+		{
+			Name.AppendChar(FChar::IsAlnum(Char) ? Char : TEXT('_'));
+		}
+		Name.RemoveFromStart(TEXT("_"));
+
+		FString Unique = Name;
+		for (int32 Suffix = 1; UsedNames.Contains(Unique); Suffix++)
+		{
+			Unique = FString::Printf(TEXT("%s_%d"), *Name, Suffix);
+		}
+		UsedNames.Add(Unique);
+		return Unique + Site.GetExtension();
+	}
+
+	static FPage& FindOrAddPage(FSite& Site, const FString& Key, const FString& Title, const TCHAR* Category)
+	{
+		if (const int32* Index = Site.PageByKey.Find(Key))
+		{
+			return Site.Pages[*Index];
+		}
+
+		Site.PageByKey.Add(Key, Site.Pages.Num());
+		FPage& Page = Site.Pages.AddDefaulted_GetRef();
+		Page.Key = Key;
+		Page.Title = Title;
+		Page.Category = Category;
+		return Page;
+	}
+
+	static bool IsStaleClass(const UStruct* Type)
+	{
+		const UClass* Class = Cast<UClass>(Type);
+		if (Class == nullptr)
+		{
+			return false;
+		}
+		const FString Name = Class->GetName();
+		return Class->HasAnyClassFlags(CLASS_NewerVersionExists | CLASS_Deprecated)
+			|| Name.StartsWith(TEXT("SKEL_"))
+			|| Name.StartsWith(TEXT("REINST_"));
+	}
+
+	static FEntry MakeEntry(const FString& Name, const FProperty* Property, const UStruct* Type, const FHintStruct& Hint)
+	{
+		FEntry Entry;
+		Entry.Name = Name;
+		Entry.Hint = DocumentationHintUtils::GetHintText(Hint.HintSource, Hint.HintText, Property, Type);
+		Entry.Tooltip = DocumentationHintUtils::GetHintText(Hint.TooltipSource, Hint.TooltipText, Property, Type);
+		Entry.Link = Hint.GetLink();
+		return Entry;
+	}
+
+	/** Saved hash from asset registry, file timestamp when registry has none. Empty if package is unknown */
+	static FString GetPackageHash(const IAssetRegistry& AssetRegistry, FName PackageName)
+	{
+		const TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(PackageName);
+		if (PackageData.IsSet() && !PackageData->PackageSavedHash.IsZero())
+		{
+			return LexToString(PackageData->PackageSavedHash);
+		}
+
+		FString FileName;
+		if (FPackageName::DoesPackageExist(PackageName.ToString(), &FileName))
+		{
+			const FDateTime TimeStamp = IFileManager::Get().GetTimeStamp(*FileName);
+			if (TimeStamp != FDateTime::MinValue())
+			{
+				return TimeStamp.ToString();
+			}
+		}
+		return FString();
+	}
+
+	/** Link key, object path or scheme payload that has own page */
+	static FString FindTargetPage(const FSite& Site, const FString& Link, const FString& Address)
+	{
+		auto FindPath = [&Site](const FString& Path) -> const FPage*
+		{
+			if (Path.IsEmpty())
+			{
+				return nullptr;
+			}
+			if (const int32* Index = Site.PageByKey.Find(Path))
+			{
+				return &Site.Pages[*Index];
+			}
+			if (Path.StartsWith(TEXT("/")))
+			{
+				if (const int32* Index = Site.PageByKey.Find(FPackageName::ObjectPathToPackageName(Path)))
+				{
+					return &Site.Pages[*Index];
+				}
+			}
+			return nullptr;
+		};
+
+		const FPage* Page = FindPath(Link);
+		if (Page == nullptr && !Address.IsEmpty())
+		{
+			Page = FindPath(FDocumentationLinkSchemes::Get().Parse(Address).Payload);
+		}
+		return Page ? Page->FileName : FString();
+	}
+
+	/**
+	 * Collect pages of types in memory, hinted packages and link tables
+	 * Hinted packages whose hash matches OldPackages are not loaded, their cached pages are used instead
+	 */
+	static void CollectPages(FSite& Site, const FPackageManifest& OldPackages, FPackageManifest& OutPackages)
+	{
+		UDocumentationUtilities::EnsureNativeLinksCollected();
+		UDocumentationUtilities::EnsureLinkTablesLoaded();
+
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+		AssetRegistry.SearchAllAssets(true);
+
+		// Registry only knows packages whose hints have links, loading them also brings blueprint classes in memory
+		TSet<FName> HintPackages;
+		DocumentationHintUtils::ForEachAssetHintLink(AssetRegistry, [&HintPackages](FName PackageName, const FString& LinkKey)
+		{
+			HintPackages.Add(PackageName);
+		});
+
+		TArray<UPackage*> LoadedPackages;
+		TArray<FName> SkippedPackages;
+		for (const FName& PackageName : HintPackages)
+		{
+			const FString Hash = GetPackageHash(AssetRegistry, PackageName);
+			const FPackageEntry* OldEntry = OldPackages.Find(PackageName);
+			if (OldEntry && !Hash.IsEmpty() && OldEntry->Hash == Hash)
+			{
+				SkippedPackages.Add(PackageName);
+				OutPackages.Add(PackageName, *OldEntry);
+				continue;
+			}
+			OutPackages.Add(PackageName).Hash = Hash;
+
+			if (UPackage* Package = LoadPackage(nullptr, *PackageName.ToString(), LOAD_NoWarn | LOAD_Quiet))
+			{
+				LoadedPackages.Add(Package);
+			}
+			else
+			{
+				UE_LOG(LogDocumentationExport, Warning, TEXT("Failed to load %s"), *PackageName.ToString());
+			}
+		}
+
+		DocumentationHintUtils::ForEachTypeDefaultHint([&Site](const UStruct* Type, const FStructProperty* Property, const FHintStruct& Hint)
+		{
+			if (IsStaleClass(Type))
+			{
+				return;
+			}
+
+			const TCHAR* Category = Type->IsA<UClass>() ? TEXT("Classes") : TEXT("Structs");
+			FPage& Page = FindOrAddPage(Site, Type->GetPathName(), Type->GetName(), Category);
+			const UPackage* Package = Type->GetOutermost();
+			if (!Package->HasAnyPackageFlags(PKG_CompiledIn))
+			{
+				Page.Package = Package->GetFName();
+			}
+			Page.Entries.Add(MakeEntry(Property->GetDisplayNameText().ToString(), Property, Type, Hint));
+		});
+
+		for (UPackage* Package : LoadedPackages)
+		{
+			ForEachObjectWithPackage(Package, [&Site, Package](UObject* Object)
+			{
+				if (Object->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+				{
+					return true;
+				}
+
+				DocumentationHintUtils::ForEachObjectHint(Object, [&Site, Package, Object](const FProperty* Property, FHintStruct& Hint)
+				{
+					const FString PackageName = Package->GetName();
+					FPage& Page = FindOrAddPage(Site, PackageName, FPackageName::GetShortName(PackageName), TEXT("Assets"));
+					Page.Package = Package->GetFName();
+					Page.Entries.Add(MakeEntry(FString::Printf(TEXT("%s.%s"), *Object->GetName(), *Property->GetDisplayNameText().ToString()), Property, Object->GetClass(), Hint));
+				});
+				return true;
+			});
+		}
+
+		// Pages of loaded packages are cached for next run
+		for (const FPage& Page : Site.Pages)
+		{
+			if (FPackageEntry* Entry = Page.Package.IsNone() ? nullptr : OutPackages.Find(Page.Package))
+			{
+				if (!SkippedPackages.Contains(Page.Package))
+				{
+					Entry->Pages.Add(Page);
+				}
+			}
+		}
+
+		// Skipped blueprint may still be in memory as dependency of loaded package, live page wins then
+		for (const FName& PackageName : SkippedPackages)
+		{
+			for (const FPage& CachedPage : OutPackages[PackageName].Pages)
+			{
+				if (!Site.PageByKey.Contains(CachedPage.Key))
+				{
+					Site.PageByKey.Add(CachedPage.Key, Site.Pages.Num());
+					FPage& Page = Site.Pages.Add_GetRef(CachedPage);
+					Page.Package = PackageName;
+				}
+			}
+		}
+		UE_LOG(LogDocumentationExport, Display, TEXT("%d hinted packages loaded, %d unchanged since last export"), LoadedPackages.Num(), SkippedPackages.Num());
+
+		TSet<FString> LinkKeys;
+		for (const TArray<FDocumentationHintLink>* Source : GetDefault<UDocumentationUtilities>()->GetSources())
+		{
+			for (const FDocumentationHintLink& Link : *Source)
+			{
+				if (Link.HasValue())
+				{
+					LinkKeys.Add(Link.GetLinkKey());
+				}
+			}
+		}
+		for (const FString& Key : LinkKeys)
+		{
+			Site.Links.Add({ Key, UDocumentationUtilities::ResolveLink(Key) });
+		}
+
+		// Stable order keeps page content and hashes the same between runs
+		Site.Pages.Sort([](const FPage& A, const FPage& B) { return A.Key < B.Key; });
+		Site.Links.Sort([](const FLinkRow& A, const FLinkRow& B) { return A.Key < B.Key; });
+
+		Site.PageByKey.Reset();
+		TSet<FString> UsedNames = { TEXT("index") };
+		for (int32 Index = 0; Index < Site.Pages.Num(); Index++)
+		{
+			FPage& Page = Site.Pages[Index];
+			Page.FileName = MakeFileName(Page.Key, Site, UsedNames);
+			Site.PageByKey.Add(Page.Key, Index);
+		}
+
+		for (FPage& Page : Site.Pages)
+		{
+			for (FEntry& Entry : Page.Entries)
+			{
+				if (!Entry.Link.IsEmpty())
+				{
+					Entry.Address = UDocumentationUtilities::ResolveLink(Entry.Link);
+				}
+				Entry.TargetPage = FindTargetPage(Site, Entry.Link, Entry.Address);
+			}
+		}
+		for (FLinkRow& Row : Site.Links)
+		{
+			Row.TargetPage = FindTargetPage(Site, Row.Key, Row.Address);
+		}
+	}
+
+	/** Writes html or markdown. Only touches FSite data, safe to use from workers */
+	class FPageWriter
+	{
+	public:
+		FPageWriter(const FSite& InSite, FString& InOut)
+			: Site(InSite), Out(InOut)
+		{
+		}
+
+		void WritePage(const FPage& Page)
+		{
+			Begin(Page.Title);
+			Heading(1, Page.Title);
+			Paragraph(Page.Key, true);
+			Reference(TEXT("Index"), FString(TEXT("index")) + Site.GetExtension());
+
+			for (const FEntry& Entry : Page.Entries)
+			{
+				Heading(2, Entry.Name);
+				Paragraph(Entry.Hint, false);
+				if (!Entry.Tooltip.IsEmpty())
+				{
+					Paragraph(Entry.Tooltip, false);
+				}
+				if (!Entry.Link.IsEmpty())
+				{
+					WriteLink(Entry.Link, Entry.Address, Entry.TargetPage);
+				}
+			}
+			End();
+		}
+
+		void WriteIndex()
+		{
+			Begin(TEXT("Documentation"));
+			Heading(1, TEXT("Documentation"));
+
+			for (const TCHAR* Category : { TEXT("Classes"), TEXT("Structs"), TEXT("Assets") })
+			{
+				bool bHasHeading = false;
+				for (const FPage& Page : Site.Pages)
+				{
+					if (Page.Category == Category)
+					{
+						if (!bHasHeading)
+						{
+							Heading(2, Category);
+							bHasHeading = true;
+						}
+						Reference(Page.Title, Page.FileName);
+					}
+				}
+			}
+
+			if (Site.Links.Num() > 0)
+			{
+				Heading(2, TEXT("Links"));
+				for (const FLinkRow& Row : Site.Links)
+				{
+					WriteLink(Row.Key, Row.Address, Row.TargetPage);
+				}
+			}
+			End();
+		}
+
+	private:
+		void Begin(const FString& Title)
+		{
+			if (!Site.bMarkdown)
+			{
+				Out += TEXT("<!DOCTYPE html>\n<html><head><meta charset=\"utf-8\"><title>");
+				Escape(Title);
+				Out += TEXT("</title></head><body>\n");
+			}
+		}
+
+		void End()
+		{
+			if (!Site.bMarkdown)
+			{
+				Out += TEXT("</body></html>\n");
+			}
+		}
+
+		void Heading(int32 Level, const FString& Text)
+		{
+			if (Site.bMarkdown)
+			{
+				Out += FString::ChrN(Level, TEXT('#'));
+				Out += TEXT(" ");
+				Escape(Text);
+				Out += TEXT("\n\n");
+			}
+			else
+			{
+				Out += FString::Printf(TEXT("<h%d>"), Level);
+				Escape(Text);
+				Out += FString::Printf(TEXT("</h%d>\n"), Level);
+			}
+		}
+
+		void Paragraph(const FString& Text, bool bCode)
+		{
+			if (Text.IsEmpty())
+			{
+				return;
+			}
+
+			if (Site.bMarkdown)
+			{
+				Out += bCode ? TEXT("`") : TEXT("");
+				Escape(Text);
+				Out += bCode ? TEXT("`\n\n") : TEXT("\n\n");
+			}
+			else
+			{
+				Out += bCode ? TEXT("<p><code>") : TEXT("<p>");
+				Escape(Text);
+				Out += bCode ? TEXT("</code></p>\n") : TEXT("</p>\n");
+			}
+		}
+
+		void Reference(const FString& Text, const FString& Target)
+		{
+			if (Site.bMarkdown)
+			{
+				Out += TEXT("- [");
+				Escape(Text);
+				Out += TEXT("](");
+				Out += Target;
+				Out += TEXT(")\n");
+			}
+			else
+			{
+				Out += TEXT("<p><a href=\"");
+				Escape(Target);
+				Out += TEXT("\">");
+				Escape(Text);
+				Out += TEXT("</a></p>\n");
+			}
+		}
+
+		void WriteLink(const FString& Link, const FString& Address, const FString& TargetPage)
+		{
+			FString Target = TargetPage;
+			if (Target.IsEmpty() && (Address.StartsWith(TEXT("http://")) || Address.StartsWith(TEXT("https://"))))
+			{
+				Target = Address;
+			}
+
+			const FString Text = Address.IsEmpty() || Address == Link ? Link : FString::Printf(TEXT("%s -> %s"), *Link, *Address);
+			if (Target.IsEmpty())
+			{
+				Paragraph(Text, true);
+			}
+			else
+			{
+				Reference(Text, Target);
+			}
+		}
+
+		void Escape(const FString& Text)
+		{
+			for (TCHAR Char : Text)
+			{
+				if (Site.bMarkdown)
+				{
+					if (FCString::Strchr(TEXT("\\`*_[]<>|#"), Char))
+					{
+						Out.AppendChar(TEXT('\\'));
+					}
+					Out.AppendChar(Char);
+				}
+				else
+				{
+					switch (Char)
+					{
+					case TEXT('&'): Out += TEXT("&amp;"); break;
+					case TEXT('<'): Out += TEXT("&lt;"); break;
+					case TEXT('>'): Out += TEXT("&gt;"); break;
+					case TEXT('"'): Out += TEXT("&quot;"); break;
+					case TEXT('\n'): Out += TEXT("<br>"); break;
+					default: Out.AppendChar(Char); break;
+					}
+				}
+			}
+		}
+
+		const FSite& Site;
+		FString& Out;
+	};
+
+	static TMap<FString, FString> LoadManifest(const FString& Path)
+	{
+		TMap<FString, FString> Manifest;
+		TArray<FString> Lines;
+		if (FFileHelper::LoadFileToStringArray(Lines, *Path))
+		{
+			for (const FString& Line : Lines)
+			{
+				FString File, Hash;
+				if (Line.Split(TEXT("\t"), &File, &Hash))
+				{
+					Manifest.Add(MoveTemp(File), MoveTemp(Hash));
+				}
+			}
+		}
+		return Manifest;
+	}
+
+	static FPackageManifest LoadPackageManifest(const FString& Path)
+	{
+		FPackageManifest Manifest;
+		TArray<uint8> Bytes;
+		if (FFileHelper::LoadFileToArray(Bytes, *Path, FILEREAD_Silent))
+		{
+			FMemoryReader Reader(Bytes);
+			int32 Version = 0;
+			Reader << Version;
+			if (Version == PackageManifestVersion)
+			{
+				Reader << Manifest;
+			}
+			if (Version != PackageManifestVersion || Reader.IsError())
+			{
+				Manifest.Reset();
+			}
+		}
+		return Manifest;
+	}
+
+	static void SavePackageManifest(FPackageManifest& Manifest, const FString& Path)
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes);
+		int32 Version = PackageManifestVersion;
+		Writer << Version;
+		Writer << Manifest;
+		FFileHelper::SaveArrayToFile(Bytes, *Path);
+	}
+}
+
+
+
+UDocumentationExportCommandlet::UDocumentationExportCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UDocumentationExportCommandlet::Main(const FString& Params)
+{
+	using namespace DocumentationExport;
+
+	FString OutputDir = FPaths::ProjectSavedDir() / TEXT("DocumentationUtilities") / TEXT("Site");
+	FParse::Value(*Params, TEXT("Output="), OutputDir);
+	OutputDir = FPaths::ConvertRelativePathToFull(OutputDir);
+
+	FString Format = TEXT("html");
+	FParse::Value(*Params, TEXT("Format="), Format);
+
+	const bool bForce = FParse::Param(*Params, TEXT("Force"));
+
+	FSite Site;
+	Site.bMarkdown = Format.Equals(TEXT("md"), ESearchCase::IgnoreCase) || Format.Equals(TEXT("markdown"), ESearchCase::IgnoreCase);
+
+	IFileManager& FileManager = IFileManager::Get();
+	FileManager.MakeDirectory(*OutputDir, true);
+
+	const FString PackageManifestPath = OutputDir / PackageManifestName;
+	FPackageManifest Packages;
+	CollectPages(Site, bForce ? FPackageManifest() : LoadPackageManifest(PackageManifestPath), Packages);
+	SavePackageManifest(Packages, PackageManifestPath);
+
+	const FString ManifestPath = OutputDir / ManifestName;
+	const TMap<FString, FString> OldManifest = bForce ? TMap<FString, FString>() : LoadManifest(ManifestPath);
+
+	// Last item is index page
+	const int32 NumFiles = Site.Pages.Num() + 1;
+	TArray<FString> FileNames;
+	TArray<FString> Hashes;
+	FileNames.SetNum(NumFiles);
+	Hashes.SetNum(NumFiles);
+
+	std::atomic<int32> NumWritten = 0;
+	std::atomic<int32> NumFailed = 0;
+
+	ParallelFor(NumFiles, [&](int32 Index)
+	{
+		// Each page is rendered, hashed and written by its worker, whole site is never kept in memory
+		FString Content;
+		FPageWriter Writer(Site, Content);
+		if (Site.Pages.IsValidIndex(Index))
+		{
+			FileNames[Index] = Site.Pages[Index].FileName;
+			Writer.WritePage(Site.Pages[Index]);
+		}
+		else
+		{
+			FileNames[Index] = FString(TEXT("index")) + Site.GetExtension();
+			Writer.WriteIndex();
+		}
+
+		FTCHARToUTF8 Converted(*Content);
+		FSHAHash Hash;
+		FSHA1::HashBuffer(Converted.Get(), Converted.Length(), Hash.Hash);
+		Hashes[Index] = Hash.ToString();
+
+		const FString FilePath = OutputDir / FileNames[Index];
+		const FString* OldHash = OldManifest.Find(FileNames[Index]);
+		if (OldHash && *OldHash == Hashes[Index] && FileManager.FileExists(*FilePath))
+		{
+			return;
+		}
+
+		TUniquePtr<FArchive> File(FileManager.CreateFileWriter(*FilePath));
+		if (!File.IsValid())
+		{
+			NumFailed++;
+			Hashes[Index].Reset();
+			return;
+		}
+		File->Serialize(const_cast<ANSICHAR*>(Converted.Get()), Converted.Length());
+		NumWritten++;
+	});
+
+	TSet<FString> NewFiles(FileNames);
+	for (const TPair<FString, FString>& Pair : OldManifest)
+	{
+		if (!NewFiles.Contains(Pair.Key))
+		{
+			FileManager.Delete(*(OutputDir / Pair.Key), false, false, true);
+		}
+	}
+
+	FString Manifest;
+	for (int32 Index = 0; Index < NumFiles; Index++)
+	{
+		if (!Hashes[Index].IsEmpty())
+		{
+			Manifest += FString::Printf(TEXT("%s\t%s\n"), *FileNames[Index], *Hashes[Index]);
+		}
+	}
+	FFileHelper::SaveStringToFile(Manifest, *ManifestPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+
+	UE_LOG(LogDocumentationExport, Display, TEXT("Exported %d pages to %s: %d written, %d unchanged, %d failed"),
+		NumFiles, *OutputDir, NumWritten.load(), NumFiles - NumWritten.load() - NumFailed.load(), NumFailed.load());
+
+	return NumFailed.load() > 0 ? 1 : 0;
+}
@@ -0,0 +1,28 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "DocumentationExportCommandlet.generated.h"
+
+/**
+ * Export hints of classes, structs and assets together with link tables as static site
+ *
+ * UnrealEditor-Cmd.exe Project.uproject -run=DocumentationExport [-Output=Dir] [-Format=html|md] [-Force]
+ *
+ * Pages are rendered in parallel and written as soon as they are ready
+ * Content hashes are kept in manifest of output directory, unchanged pages are not rewritten
+ * Hinted packages are loaded only when their saved hash changed since last export, otherwise pages
+ * cached in package manifest are reused. -Force ignores both manifests
+ */
+UCLASS()
+class UDocumentationExportCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UDocumentationExportCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
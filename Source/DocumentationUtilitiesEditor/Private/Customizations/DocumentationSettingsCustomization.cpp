@@ -0,0 +1,38 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "DocumentationSettingsCustomization.h"
+#include "DocumentationUtilitiesSettings.h"
+#include "Widgets/SDocumentationLinkTable.h"
+
+#include <DetailLayoutBuilder.h>
+#include <DetailCategoryBuilder.h>
+#include <DetailWidgetRow.h>
+
+
+
+#define LOCTEXT_NAMESPACE "DocumentationUtilities"
+
+void FDocumentationSettingsCustomization::CustomizeDetails(IDetailLayoutBuilder& DetailBuilder)
+{
+	// Page shows NativeLinks, make sure deferred collection is done before rows are built
+	UDocumentationUtilities::EnsureNativeLinksCollected();
+
+	// Link arrays can have thousands of entries, show them in one virtualized table instead of property rows
+	DetailBuilder.HideProperty(GET_MEMBER_NAME_CHECKED(UDocumentationUtilities, NativeLinks));
+	DetailBuilder.HideProperty(GET_MEMBER_NAME_CHECKED(UDocumentationUtilities, AssetHintLinks));
+	DetailBuilder.HideProperty(GET_MEMBER_NAME_CHECKED(UDocumentationUtilities, Links));
+	DetailBuilder.HideProperty(GET_MEMBER_NAME_CHECKED(UDocumentationUtilities, LinksOverride));
+
+	IDetailCategoryBuilder& Category = DetailBuilder.EditCategory(TEXT("Documentation: Links"));
+	Category.AddCustomRow(LOCTEXT("LinkTable_RowFilter", "Links"))
+	.WholeRowContent()
+	[
+		SNew(SBox)
+		.HeightOverride(500.f)
+		[
+			SNew(SDocumentationLinkTable)
+		]
+	];
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,20 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IDetailCustomization.h"
+
+/** Settings page of UDocumentationUtilities */
+class FDocumentationSettingsCustomization : public IDetailCustomization
+{
+public:
+	static TSharedRef<IDetailCustomization> MakeInstance()
+	{
+		return MakeShareable(new FDocumentationSettingsCustomization);
+	}
+
+	//~ Begin IDetailCustomization Interface
+	virtual void CustomizeDetails(IDetailLayoutBuilder& DetailBuilder) override;
+	//~ End IDetailCustomization Interface
+};
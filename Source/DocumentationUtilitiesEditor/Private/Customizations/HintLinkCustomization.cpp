@@ -36,6 +36,7 @@ void FHintLinkCustomization::CustomizeHeader(TSharedRef<IPropertyHandle> Propert
 				case EDocumentationLinkType::Class: return 3;
 				case EDocumentationLinkType::String: return 1;
 				case EDocumentationLinkType::Native: return 1;
+				case EDocumentationLinkType::AssetHint: return 1;
 				}
 			}
 		}
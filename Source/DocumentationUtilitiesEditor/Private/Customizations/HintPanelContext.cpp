@@ -0,0 +1,210 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "HintPanelContext.h"
+#include "DocumentationUtilitiesEditor.h"
+#include "DocumentationUtilitiesSettings.h"
+#include "DocumentationUtilitiesMemory.h"
+#include "DocumentationLinkSnapshot.h"
+#include "HintStruct.h"
+
+#include <PropertyHandle.h>
+#include <IPropertyUtilities.h>
+#include <IPropertyTypeCustomization.h>
+
+
+
+FHintPanelContext::FHintPanelContext()
+{
+	FDocumentationLinkReadScope Snapshot;
+	SnapshotSerial = Snapshot->GetSerial();
+
+	FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FHintPanelContext::OnObjectPropertyChanged);
+}
+
+FHintPanelContext::~FHintPanelContext()
+{
+	FCoreUObjectDelegates::OnObjectPropertyChanged.RemoveAll(this);
+}
+
+TSharedRef<FHintPanelContext> FHintPanelContext::Get(IPropertyTypeCustomizationUtils& CustomizationUtils)
+{
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+
+	static TMap<const IPropertyUtilities*, TWeakPtr<FHintPanelContext>> Contexts;
+
+	TSharedPtr<IPropertyUtilities> Utilities = CustomizationUtils.GetPropertyUtilities();
+	if (!Utilities.IsValid())
+	{
+		return MakeShared<FHintPanelContext>();
+	}
+
+	// Context lives while any customization of the panel holds it
+	for (auto It = Contexts.CreateIterator(); It; ++It)
+	{
+		if (!It->Value.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	if (TWeakPtr<FHintPanelContext>* Existing = Contexts.Find(Utilities.Get()))
+	{
+		TSharedPtr<FHintPanelContext> Context = Existing->Pin();
+		if (Context.IsValid() && Context->PropertyUtilities == Utilities)
+		{
+			// Rows are rebuilt for new selection, which is checked once per row rather than on every lookup
+			if (Context->SelectedObjects != Utilities->GetSelectedObjects())
+			{
+				Context->SelectedObjects = Utilities->GetSelectedObjects();
+				Context->Reset();
+			}
+			Context->ResetIfStale();
+			return Context.ToSharedRef();
+		}
+	}
+
+	TSharedRef<FHintPanelContext> Context = MakeShared<FHintPanelContext>();
+	Context->PropertyUtilities = Utilities;
+	Context->SelectedObjects = Utilities->GetSelectedObjects();
+	Contexts.Add(Utilities.Get(), Context);
+	return Context;
+}
+
+void FHintPanelContext::Reset()
+{
+	RootOuters.Reset();
+	ClassHints.Reset();
+	Links.Reset();
+	bPropertyChanged = false;
+}
+
+void FHintPanelContext::ResetIfStale()
+{
+	FDocumentationLinkReadScope Snapshot;
+	if (bPropertyChanged || SnapshotSerial != Snapshot->GetSerial())
+	{
+		SnapshotSerial = Snapshot->GetSerial();
+		Reset();
+	}
+}
+
+void FHintPanelContext::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	// Edit can add elements, replace instanced objects or change hint sources
+	bPropertyChanged = true;
+}
+
+const TArray<UObject*>& FHintPanelContext::GetOuterObjects(const TSharedRef<IPropertyHandle>& PropertyHandle)
+{
+	ResetIfStale();
+
+	// Outers change only at instanced object, everything nested in structs and containers above it shares them
+	TSharedPtr<IPropertyHandle> RootHandle = PropertyHandle;
+	for (TSharedPtr<IPropertyHandle> Parent = RootHandle->GetParentHandle(); Parent.IsValid(); Parent = Parent->GetParentHandle())
+	{
+		if (CastField<FObjectPropertyBase>(Parent->GetProperty()))
+		{
+			break;
+		}
+		RootHandle = Parent;
+	}
+
+	TSharedPtr<FPropertyNode> RootNode = RootHandle->GetPropertyNode();
+	if (!RootNode.IsValid())
+	{
+		UncachedOuters.Reset();
+		PropertyHandle->GetOuterObjects(UncachedOuters);
+		return UncachedOuters;
+	}
+
+	FCachedOuters& Cached = RootOuters.FindOrAdd(RootNode.Get());
+	if (Cached.Node.Pin() != RootNode)
+	{
+		Cached.Node = RootNode;
+		Cached.Outers.Reset();
+		PropertyHandle->GetOuterObjects(Cached.Outers);
+	}
+	return Cached.Outers;
+}
+
+const FText& FHintPanelContext::GetClassHint(const UClass* Class, EHintSource Mode)
+{
+	ResetIfStale();
+
+	const TPair<const UClass*, EHintSource> Key(Class, Mode);
+	if (const FText* Cached = ClassHints.Find(Key))
+	{
+		return *Cached;
+	}
+	return ClassHints.Add(Key, ComputeClassHint(Class, Mode));
+}
+
+FText FHintPanelContext::ComputeClassHint(const UClass* Class, EHintSource Mode)
+{
+	FText Hint;
+	if (Class == nullptr)
+	{
+		return Hint;
+	}
+
+	switch (Mode)
+	{
+	case EHintSource::ClassTooltip:
+		Hint = Class->GetToolTipText();
+		break;
+	case EHintSource::FirstValidTooltip:
+		for (; Class != nullptr; Class = Class->GetSuperClass())
+		{
+			Hint = Class->GetToolTipText();
+			if (!Hint.IsEmpty() && !Hint.EqualToCaseIgnored(Class->GetDisplayNameText()))
+			{
+				break;
+			}
+		}
+		break;
+	case EHintSource::NativeClassTooltip:
+		for (; Class != nullptr; Class = Class->GetSuperClass())
+		{
+			if (Class->HasAnyClassFlags(CLASS_Native))
+			{
+				Hint = Class->GetToolTipText();
+				break;
+			}
+		}
+		break;
+	case EHintSource::PropertyValue:
+	case EHintSource::PropertyTooltip:
+	case EHintSource::MAX:
+		break;
+	}
+	return Hint;
+}
+
+FHintPanelContext::FResolvedLink& FHintPanelContext::FindOrResolve(const FString& Link)
+{
+	ResetIfStale();
+
+	if (FResolvedLink* Cached = Links.Find(Link))
+	{
+		return *Cached;
+	}
+
+	FResolvedLink& Resolved = Links.Add(Link);
+	Resolved.Address = UDocumentationUtilities::ResolveLink(Link);
+	return Resolved;
+}
+
+const FString& FHintPanelContext::ResolveLink(const FString& Link)
+{
+	return FindOrResolve(Link).Address;
+}
+
+bool FHintPanelContext::IsLinkValid(const FString& Link)
+{
+	FResolvedLink& Resolved = FindOrResolve(Link);
+	if (!Resolved.bIsValid.IsSet())
+	{
+		Resolved.bIsValid = IDocumentationUtilitiesEditorModule::IsLinkValid(Link);
+	}
+	return Resolved.bIsValid.GetValue();
+}
@@ -0,0 +1,68 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IPropertyHandle;
+class IPropertyUtilities;
+class IPropertyTypeCustomizationUtils;
+class FPropertyNode;
+enum class EHintSource : uint8;
+
+/**
+ * Data shared by all FHintStructCustomization instances of one details view
+ *
+ * Cached values are dropped when selection of the panel changes, any property is edited or link snapshot changes
+ */
+class FHintPanelContext
+{
+public:
+	FHintPanelContext();
+	~FHintPanelContext();
+
+	static TSharedRef<FHintPanelContext> Get(IPropertyTypeCustomizationUtils& CustomizationUtils);
+
+	/** Outers are shared by all properties nested in the same top level property, including container elements */
+	const TArray<UObject*>& GetOuterObjects(const TSharedRef<IPropertyHandle>& PropertyHandle);
+
+	/** Hint that depends only on class: ClassTooltip, FirstValidTooltip, NativeClassTooltip */
+	const FText& GetClassHint(const UClass* Class, EHintSource Mode);
+
+	const FString& ResolveLink(const FString& Link);
+	bool IsLinkValid(const FString& Link);
+
+private:
+	struct FResolvedLink
+	{
+		FString Address;
+		TOptional<bool> bIsValid;
+	};
+
+	struct FCachedOuters
+	{
+		/** Node address alone can be reused after panel rebuild */
+		TWeakPtr<FPropertyNode> Node;
+		TArray<UObject*> Outers;
+	};
+
+	void Reset();
+	void ResetIfStale();
+	void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+	FResolvedLink& FindOrResolve(const FString& Link);
+
+	static FText ComputeClassHint(const UClass* Class, EHintSource Mode);
+
+	TWeakPtr<IPropertyUtilities> PropertyUtilities;
+	TArray<TWeakObjectPtr<UObject>> SelectedObjects;
+	uint64 SnapshotSerial = 0;
+	bool bPropertyChanged = false;
+
+	/** Keyed by node of top level property, or of property inside instanced object */
+	TMap<const FPropertyNode*, FCachedOuters> RootOuters;
+	TMap<TPair<const UClass*, EHintSource>, FText> ClassHints;
+	TMap<FString, FResolvedLink> Links;
+
+	/** Outers for handles without property node */
+	TArray<UObject*> UncachedOuters;
+};
@@ -4,13 +4,21 @@
 #include "DocumentationUtilitiesEditor.h"
 #include "HintStruct.h"
 #include "DocumentationUtilitiesSettings.h"
+#include "Widgets/HintMarkdown.h"
+#include "Widgets/SDocumentationPreview.h"
+#include "DocumentationSourceIndex.h"
+#include "HintPanelContext.h"
+#include "HintTemplate.h"
 
 #include <DetailWidgetRow.h>
 #include <IDetailChildrenBuilder.h>
 #include <PropertyCustomizationHelpers.h>
+#include <Widgets/SToolTip.h>
 
 #include <HAL/PlatformProcess.h>
 #include <HAL/PlatformApplicationMisc.h>
+#include <Misc/PackageName.h>
+#include <ScopedTransaction.h>
 
 
 
@@ -20,20 +28,21 @@
 
 void FHintStructCustomization::CustomizeHeader(TSharedRef<IPropertyHandle> PropertyHandle, FDetailWidgetRow& HeaderRow, IPropertyTypeCustomizationUtils& CustomizationUtils)
 {
+	HintStructHandle = PropertyHandle;
 	LinkAddressPathHandle = PropertyHandle->GetChildHandle(GET_MEMBER_NAME_CHECKED(FHintStruct, LinkAddressPath));
 	LinkAddressHandle = PropertyHandle->GetChildHandle(GET_MEMBER_NAME_CHECKED(FHintStruct, LinkAddress));
 
+	PanelContext = FHintPanelContext::Get(CustomizationUtils);
 
-	TArray<UObject*> Outers;
-	PropertyHandle->GetOuterObjects(Outers);
+	const TArray<UObject*> Outers = PanelContext->GetOuterObjects(PropertyHandle);
 
-	FText HintText = GetHint(
+	TAttribute<FText> HintText = GetHint(
 			PropertyHandle, 
 			PropertyHandle->GetChildHandle(GET_MEMBER_NAME_CHECKED(FHintStruct, HintText)).ToSharedRef(), 
 			PropertyHandle->GetChildHandle(GET_MEMBER_NAME_CHECKED(FHintStruct, HintSource)).ToSharedRef(),
 			Outers);	
 
-	FText HintTooltipText = GetHint(
+	TAttribute<FText> HintTooltipText = GetHint(
 		PropertyHandle,
 		PropertyHandle->GetChildHandle(GET_MEMBER_NAME_CHECKED(FHintStruct, TooltipText)).ToSharedRef(),
 		PropertyHandle->GetChildHandle(GET_MEMBER_NAME_CHECKED(FHintStruct, TooltipSource)).ToSharedRef(),
@@ -59,11 +68,7 @@ void FHintStructCustomization::CustomizeHeader(TSharedRef<IPropertyHandle> Prope
 			.VAlign(VAlign_Center)
 			.Padding(0, 2)
 			[
-				SNew(STextBlock)
-				.Font(IPropertyTypeCustomizationUtils::GetRegularFont())
-				.AutoWrapText(true)
-				.Text(HintText)
-				.ToolTipText(HintTooltipText)
+				FHintMarkdownParser::MakeHintWidget(HintText, HintTooltipText)
 			]
 		]
 		+ SHorizontalBox::Slot().AutoWidth().Padding(5, 0)
@@ -73,11 +78,19 @@ void FHintStructCustomization::CustomizeHeader(TSharedRef<IPropertyHandle> Prope
 			.VAlign(VAlign_Center)
 			.WidthOverride(22)
 			.HeightOverride(22)
-			.ToolTipText(FText::FromString(GetLinkAddress()))
+			.ToolTip(SNew(SToolTip)
+			[
+				SNew(SDocumentationPreview)
+				.Address(GetLinkAddress())
+			])
 			.Visibility(GetLink().IsEmpty() ? EVisibility::Collapsed : EVisibility::Visible)
 			[	
 				SNew(SButton)
 				.ButtonStyle(FAppStyle::Get(), "SimpleButton")
+				.OnHovered_Lambda([this]()
+				{
+					IDocumentationUtilitiesEditorModule::PrefetchLink(GetLink());
+				})
 				.OnClicked_Lambda([this]()
 				{
 					IDocumentationUtilitiesEditorModule::OpenLink(GetLink());
@@ -118,8 +131,7 @@ void FHintStructCustomization::CustomizeChildren(TSharedRef<IPropertyHandle> Pro
 
 	bool bIsCDO = false;
 	{
-		TArray<UObject*> Outers;
-		PropertyHandle->GetOuterObjects(Outers);
+		const TArray<UObject*>& Outers = PanelContext->GetOuterObjects(PropertyHandle);
 		bIsCDO = Outers.Num() > 0 && Outers[0]->HasAnyFlags(RF_ClassDefaultObject);
 	}
 
@@ -138,7 +150,7 @@ void FHintStructCustomization::CustomizeChildren(TSharedRef<IPropertyHandle> Pro
 			FString Link = GetLink(); 
 			if (!Link.IsEmpty() && Link != TEXT("None"))
 			{
-				bLinkError = !IDocumentationUtilitiesEditorModule::IsLinkValid(Link);
+				bLinkError = !PanelContext->IsLinkValid(Link);
 			}
 		}
 		
@@ -229,7 +241,7 @@ void FHintStructCustomization::CustomizeChildren(TSharedRef<IPropertyHandle> Pro
 	}
 }
 
-FText FHintStructCustomization::GetHint(TSharedRef<IPropertyHandle> StructHandle, TSharedRef<IPropertyHandle> ManualValueHandle, TSharedRef<IPropertyHandle> ModeHandle, TArray<UObject*> OuterChain) const
+TAttribute<FText> FHintStructCustomization::GetHint(TSharedRef<IPropertyHandle> StructHandle, TSharedRef<IPropertyHandle> ManualValueHandle, TSharedRef<IPropertyHandle> ModeHandle, const TArray<UObject*>& OuterChain) const
 {
 	FText Hint;
 
@@ -254,40 +266,21 @@ FText FHintStructCustomization::GetHint(TSharedRef<IPropertyHandle> StructHandle
 	{
 	case EHintSource::PropertyValue:
 		ManualValueHandle->GetValueAsDisplayText(Hint);
+		if (Outer && FHintTemplate::MayHavePlaceholders(Hint.ToString()))
+		{
+			// {Property} placeholders show live values of the outer object
+			return FHintTemplateCache::Get().MakeText(Outer, Hint.ToString());
+		}
 		break;
 	case EHintSource::PropertyTooltip:
 		Hint = StructHandle->GetToolTipText();
 		break;
 	case EHintSource::ClassTooltip:
-		if (Outer)
-		{
-			Hint = Outer->GetClass()->GetToolTipText();
-		}		
-		break;
 	case EHintSource::FirstValidTooltip:
-		if (Outer)
-		{
-			for (const UClass* Class = Outer->GetClass(); Class != nullptr; Class = Class->GetSuperClass())
-			{
-				Hint = Class->GetToolTipText();
-				if (!Hint.IsEmpty() && !Hint.EqualToCaseIgnored(Class->GetDisplayNameText()))
-				{
-					break;
-				}
-			}
-		}
-		break;
 	case EHintSource::NativeClassTooltip:
 		if (Outer)
 		{
-			for (const UClass* Class = Outer->GetClass(); Class != nullptr; Class = Class->GetSuperClass())
-			{
-				if (Class->HasAnyClassFlags(CLASS_Native))
-				{
-					Hint = Class->GetToolTipText();
-					break;
-				}
-			}
+			Hint = PanelContext->GetClassHint(Outer->GetClass(), Mode);
 		}
 		break;
 	case EHintSource::MAX:
@@ -301,22 +294,50 @@ FText FHintStructCustomization::GetHint(TSharedRef<IPropertyHandle> StructHandle
 
 void FHintStructCustomization::SetLink(FString NewLink, bool bTryLock/* = true*/)
 {
-	if (LinkAddressPathHandle.IsValid() && LinkAddressHandle.IsValid())
+	EditHints(LOCTEXT("SetLink", "Set Link"), [&NewLink, bTryLock](FHintStruct& Hint)
 	{
-		FScopedTransaction Transaction(LOCTEXT("SetLink", "Set Link"));
+		ApplyLink(Hint, NewLink, bTryLock);
+	});
+}
 
-		FString Path;
+void FHintStructCustomization::ApplyLink(FHintStruct& Hint, const FString& NewLink, bool bTryLock)
+{
+	const bool bHasPath = bTryLock && FPackageName::IsValidObjectPath(NewLink);
+	Hint.LinkAddressPath = bHasPath ? FSoftObjectPath(NewLink) : FSoftObjectPath();
+	Hint.LinkAddress = bHasPath ? FString() : NewLink;
+}
 
-		LinkAddressPathHandle->SetValueFromFormattedString(TEXT("None"));
-		if (bTryLock)
+void FHintStructCustomization::EditHints(const FText& TransactionText, TFunctionRef<void(FHintStruct& Hint)> Edit)
+{
+	if (!HintStructHandle.IsValid() || !HintStructHandle->IsValidHandle())
+	{
+		return;
+	}
+
+	TArray<void*> RawData;
+	HintStructHandle->AccessRawData(RawData);
+	if (RawData.Num() == 0)
+	{
+		return;
+	}
+
+	// Edited copies go through the handle as text, so archetype changes propagate to instances at default
+	TArray<FString> Values;
+	Values.Reserve(RawData.Num());
+	for (void* Data : RawData)
+	{
+		FString& Value = Values.AddDefaulted_GetRef();
+		if (Data)
 		{
-			LinkAddressPathHandle->SetValueFromFormattedString(NewLink);
-			LinkAddressPathHandle->GetValueAsFormattedString(Path);
+			FHintStruct Hint = *static_cast<const FHintStruct*>(Data);
+			Edit(Hint);
+			FHintStruct::StaticStruct()->ExportText(Value, &Hint, nullptr, nullptr, PPF_None, nullptr);
 		}
+	}
 
-		bool bHasPath = !Path.IsEmpty() && Path != TEXT("None");
-		LinkAddressHandle->SetValueFromFormattedString(bHasPath ? TEXT("") : NewLink);
-	}	
+	// One transaction and one change notification for all outers
+	FScopedTransaction Transaction(TransactionText);
+	HintStructHandle->SetPerObjectValues(Values);
 }
 
 FString FHintStructCustomization::GetLink() const
@@ -339,8 +360,7 @@ FString FHintStructCustomization::GetLink() const
 FString FHintStructCustomization::GetLinkAddress() const
 {
 	FString Link = GetLink();	
-	FString Address = UDocumentationUtilities::ResolveLink(Link);
-	return Address;
+	return PanelContext.IsValid() ? PanelContext->ResolveLink(Link) : UDocumentationUtilities::ResolveLink(Link);
 }
 
 FText FHintStructCustomization::GetLinkText() const
@@ -362,26 +382,18 @@ void FHintStructCustomization::ToggleLock()
 	{
 		if (Path != TEXT("None"))
 		{
-			FScopedTransaction Transaction(LOCTEXT("UnlockLink", "Unlock Link"));
-
-			LinkAddressPathHandle->SetValueFromFormattedString(TEXT("None"));
-			LinkAddressHandle->SetValue(Path);
+			EditHints(LOCTEXT("UnlockLink", "Unlock Link"), [](FHintStruct& Hint)
+			{
+				Hint.LinkAddress = Hint.GetLink();
+				Hint.LinkAddressPath.Reset();
+			});
 		}
 		else
 		{
-			FScopedTransaction Transaction(LOCTEXT("LockLink", "Lock Link"));
-						
-			Path.Reset();
-
-			FString NewLink;
-			LinkAddressHandle->GetValueAsFormattedString(NewLink);
-
-			LinkAddressPathHandle->SetValueFromFormattedString(TEXT("None"));
-			LinkAddressPathHandle->SetValueFromFormattedString(NewLink);
-			LinkAddressPathHandle->GetValueAsFormattedString(Path);
-
-			bool bHasPath = !Path.IsEmpty() && Path != TEXT("None");
-			LinkAddressHandle->SetValueFromFormattedString(bHasPath ? TEXT("") : NewLink);
+			EditHints(LOCTEXT("LockLink", "Lock Link"), [](FHintStruct& Hint)
+			{
+				ApplyLink(Hint, Hint.LinkAddress, true);
+			});
 		}
 	}
 }
@@ -412,6 +424,8 @@ void FHintStructCustomization::AddressChanged(const FText& NewValue, ETextCommit
 
 TSharedRef<SWidget> FHintStructCustomization::CreateLinkOptions()
 {
+	UDocumentationUtilities::EnsureNativeLinksCollected();
+
 	FMenuBuilder MenuBuilder(true, nullptr);
 
 	const UDocumentationUtilities* Settings = GetDefault<UDocumentationUtilities>();
@@ -455,6 +469,22 @@ TSharedRef<SWidget> FHintStructCustomization::CreateLinkOptions()
 				FUIAction LinkAction(FExecuteAction::CreateSP(this, &FHintStructCustomization::SetLinkAndLock, OptionValue));
 				MenuBuilder.AddMenuEntry(LOCTEXT("LinkOption_ClassShort", "Class Short"), FText::FromString(OptionValue), FSlateIcon(), LinkAction);
 			}
+
+			if (Settings->bIndexSourceFiles)
+			{
+				const UClass* NativeClass = OuterClass;
+				while (NativeClass && !NativeClass->HasAnyClassFlags(CLASS_Native))
+				{
+					NativeClass = NativeClass->GetSuperClass();
+				}
+
+				FString OptionValue = FDocumentationSourceIndex::MakeLink(NativeClass);
+				if (!OptionValue.IsEmpty())
+				{
+					FUIAction LinkAction(FExecuteAction::CreateSP(this, &FHintStructCustomization::SetLinkAndLock, OptionValue));
+					MenuBuilder.AddMenuEntry(LOCTEXT("LinkOption_Source", "Source"), FText::FromString(OptionValue), FSlateIcon(), LinkAction);
+				}
+			}
 		}
 
 
@@ -485,6 +515,29 @@ TSharedRef<SWidget> FHintStructCustomization::CreateLinkOptions()
 		}
 
 
+		if (Settings->bLinksPicker_ShowAssetHints)
+		{
+			LinkOptions = Settings->CollectLinksOfType(EDocumentationLinkType::AssetHint);
+			if (LinkOptions.Num() > 0)
+			{
+				MenuBuilder.BeginSection("AssetHint", LOCTEXT("SectionAssetHint", "Asset Hints"));	
+				for (auto& KeyValuePair : LinkOptions)
+				{
+					FString LinkKey = KeyValuePair.Key;
+					FString DisplayName = LinkKey;
+					if (Settings->bLinksPicker_ShortNames)
+					{
+						LinkKey.Split(TEXT("."), nullptr, &DisplayName);
+					}
+
+					FUIAction LinkAction(FExecuteAction::CreateSP(this, &FHintStructCustomization::SetLinkAndLock, LinkKey));
+					MenuBuilder.AddMenuEntry(FText::FromString(DisplayName), KeyValuePair.Value.IsEmpty() ? LOCTEXT("LinkOption_NoValue", "Discovered in assets, no link value yet") : FText::FromString(KeyValuePair.Value), FSlateIcon(), LinkAction);
+				}
+				MenuBuilder.EndSection();
+			}
+		}
+
+
 		if (Settings->bLinksPicker_ShowString)
 		{
 			LinkOptions = Settings->CollectLinksOfType(EDocumentationLinkType::String);
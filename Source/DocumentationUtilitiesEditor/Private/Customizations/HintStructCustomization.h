@@ -6,7 +6,9 @@
 #include "IDetailCustomization.h"
 
 class IPropertyHandle;
+class FHintPanelContext;
 enum class EHintSource : uint8;
+struct FHintStruct;
 
 class FHintStructCustomization : public IPropertyTypeCustomization
 {
@@ -22,7 +24,8 @@ public:
 	//~ End IPropertyTypeCustomization Interface
 
 protected:
-	FText GetHint(TSharedRef<IPropertyHandle> StructHandle, TSharedRef<IPropertyHandle> ManualValueHandle, TSharedRef<IPropertyHandle> ModeHandle, TArray<UObject*> OuterChain) const;
+	/** Hint of selected mode, bound to outer object values when manual text is template */
+	TAttribute<FText> GetHint(TSharedRef<IPropertyHandle> StructHandle, TSharedRef<IPropertyHandle> ManualValueHandle, TSharedRef<IPropertyHandle> ModeHandle, const TArray<UObject*>& OuterChain) const;
 
 	void SetLink(FString NewLink, bool bTryLock = true);
 	void SetLinkAndLock(FString NewLink) { SetLink(NewLink, true); }
@@ -42,9 +45,20 @@ protected:
 
 	TSharedRef<SWidget> CreateLinkOptions();
 
+	/** 
+	 * Edit every selected FHintStruct in place with one pre/post change notification
+	 * Setting values through handles notifies and refreshes once per handle call for every selected object
+	 */
+	void EditHints(const FText& TransactionText, TFunctionRef<void(FHintStruct& Hint)> Edit);
+
+	/** Lock makes object path link when NewLink is valid object path */
+	static void ApplyLink(FHintStruct& Hint, const FString& NewLink, bool bTryLock);
+
 private:
-	//TSharedPtr<IPropertyHandle> HintStructHandle;
+	TSharedPtr<IPropertyHandle> HintStructHandle;
 
 	TSharedPtr<IPropertyHandle> LinkAddressPathHandle;
 	TSharedPtr<IPropertyHandle> LinkAddressHandle;
+
+	TSharedPtr<FHintPanelContext> PanelContext;
 };
@@ -0,0 +1,199 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "DocumentationAssetLoader.h"
+
+#include <Editor.h>
+#include <Framework/Notifications/NotificationManager.h>
+#include <Misc/PackageName.h>
+#include <UObject/ObjectRedirector.h>
+#include <UObject/Package.h>
+#include <Widgets/Notifications/SNotificationList.h>
+
+
+
+#define LOCTEXT_NAMESPACE "DocumentationUtilities"
+
+namespace DocumentationAssetLoader
+{
+	/** Prefetched packages kept alive until this many newer ones are loaded */
+	static constexpr int32 MaxRecentPackages = 8;
+
+	/** Asset at ObjectPath, or target of redirector left there by rename */
+	static UObject* FindAsset(const FString& ObjectPath)
+	{
+		UObject* Object = FindObject<UObject>(nullptr, *ObjectPath);
+		for (int32 Depth = 0; Depth < 8; Depth++)
+		{
+			const UObjectRedirector* Redirector = Cast<UObjectRedirector>(Object);
+			if (Redirector == nullptr)
+			{
+				break;
+			}
+			Object = Redirector->DestinationObject;
+		}
+		return Cast<UObjectRedirector>(Object) ? nullptr : Object;
+	}
+}
+
+FDocumentationAssetLoader& FDocumentationAssetLoader::Get()
+{
+	static FDocumentationAssetLoader Instance;
+	return Instance;
+}
+
+FString FDocumentationAssetLoader::GetObjectPath(const FString& Path)
+{
+	if (Path.Contains(TEXT(".")))
+	{
+		return Path;
+	}
+	return Path + TEXT(".") + FPackageName::GetShortName(Path);
+}
+
+void FDocumentationAssetLoader::Prefetch(const FString& Path)
+{
+	const FString ObjectPath = GetObjectPath(Path);
+	if (FPackageName::IsScriptPackage(ObjectPath) || FindObject<UObject>(nullptr, *ObjectPath))
+	{
+		return;
+	}
+
+	StartLoad(ObjectPath);
+}
+
+void FDocumentationAssetLoader::Open(const FString& Path, EAssetTypeActivationOpenedMethod Method)
+{
+	const FString ObjectPath = GetObjectPath(Path);
+
+	// Native types and loaded assets open right away
+	UObject* Loaded = DocumentationAssetLoader::FindAsset(ObjectPath);
+	if (Loaded || FPackageName::IsScriptPackage(ObjectPath))
+	{
+		if (Loaded)
+		{
+			GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->OpenEditorForAsset(Loaded, EToolkitMode::Standalone, TSharedPtr<IToolkitHost>(), true, Method);
+		}
+		else
+		{
+			GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->OpenEditorForAsset(ObjectPath, Method);
+		}
+		return;
+	}
+
+	// Null when load finished right away, completion already opened the asset
+	FPendingLoad* Pending = StartLoad(ObjectPath, Method);
+	if (Pending == nullptr)
+	{
+		return;
+	}
+
+	if (!Pending->Notification.IsValid())
+	{
+		const FName PackageName = *FPackageName::ObjectPathToPackageName(ObjectPath);
+		const FText AssetName = FText::FromString(FPackageName::GetShortName(PackageName));
+
+		FNotificationInfo Info(FText::GetEmpty());
+		Info.Text = TAttribute<FText>::CreateLambda([PackageName, AssetName]()
+		{
+			const float Percent = GetAsyncLoadPercentage(PackageName);
+			return Percent >= 0.f
+				? FText::Format(LOCTEXT("LoadingAssetProgress", "Loading {0}... {1}%"), AssetName, FText::AsNumber(FMath::FloorToInt(Percent)))
+				: FText::Format(LOCTEXT("LoadingAsset", "Loading {0}..."), AssetName);
+		});
+		Info.bFireAndForget = false;
+		Info.ExpireDuration = 2.f;
+
+		Pending->Notification = FSlateNotificationManager::Get().AddNotification(Info);
+		if (Pending->Notification.IsValid())
+		{
+			Pending->Notification->SetCompletionState(SNotificationItem::CS_Pending);
+		}
+	}
+}
+
+void FDocumentationAssetLoader::Shutdown()
+{
+	for (TPair<FName, FPendingLoad>& Pair : PendingLoads)
+	{
+		if (Pair.Value.Notification.IsValid())
+		{
+			Pair.Value.Notification->ExpireAndFadeout();
+		}
+	}
+	PendingLoads.Empty();
+	RecentPackages.Empty();
+}
+
+FDocumentationAssetLoader::FPendingLoad* FDocumentationAssetLoader::StartLoad(const FString& ObjectPath, TOptional<EAssetTypeActivationOpenedMethod> OpenMethod)
+{
+	const FString PackageName = FPackageName::ObjectPathToPackageName(ObjectPath);
+	if (!FPackageName::IsValidLongPackageName(PackageName))
+	{
+		return nullptr;
+	}
+
+	const FName PackageFName = *PackageName;
+	if (FPendingLoad* Existing = PendingLoads.Find(PackageFName))
+	{
+		if (OpenMethod.IsSet())
+		{
+			Existing->OpenMethod = OpenMethod;
+		}
+		return Existing;
+	}
+
+	FPendingLoad& Pending = PendingLoads.Add(PackageFName);
+	Pending.ObjectPath = ObjectPath;
+	Pending.OpenMethod = OpenMethod;
+
+	LoadPackageAsync(PackageName, FLoadPackageAsyncDelegate::CreateRaw(this, &FDocumentationAssetLoader::OnPackageLoaded));
+
+	// Completion may run inside LoadPackageAsync when package is already in memory
+	return PendingLoads.Find(PackageFName);
+}
+
+void FDocumentationAssetLoader::OnPackageLoaded(const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result)
+{
+	FPendingLoad Pending;
+	if (!PendingLoads.RemoveAndCopyValue(PackageName, Pending))
+	{
+		return;
+	}
+
+	UObject* Asset = Result == EAsyncLoadingResult::Succeeded ? DocumentationAssetLoader::FindAsset(Pending.ObjectPath) : nullptr;
+	if (Asset)
+	{
+		KeepAlive(Package);
+	}
+
+	if (Pending.Notification.IsValid())
+	{
+		if (Asset == nullptr)
+		{
+			Pending.Notification->SetText(FText::Format(LOCTEXT("LoadingAssetFailed", "Failed to load {0}"), FText::FromString(Pending.ObjectPath)));
+		}
+		Pending.Notification->SetCompletionState(Asset ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+		Pending.Notification->ExpireAndFadeout();
+	}
+
+	if (Asset && Pending.OpenMethod.IsSet() && GEditor)
+	{
+		GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->OpenEditorForAsset(Asset, EToolkitMode::Standalone, TSharedPtr<IToolkitHost>(), true, Pending.OpenMethod.GetValue());
+	}
+}
+
+void FDocumentationAssetLoader::KeepAlive(UPackage* Package)
+{
+	if (Package == nullptr)
+	{
+		return;
+	}
+
+	if (RecentPackages.Num() >= DocumentationAssetLoader::MaxRecentPackages)
+	{
+		RecentPackages.RemoveAt(0);
+	}
+	RecentPackages.Emplace(Package);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,49 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+
+class SNotificationItem;
+
+/**
+ * Opens assets of '/', 'Edit:' and 'View:' links without blocking editor on package load
+ *
+ * Prefetch starts async load on hover of help button, Open waits for it with progress notification and opens editor when loaded
+ * Recently prefetched packages are kept alive, so garbage collection does not undo prefetch before click
+ * Game thread only
+ */
+class FDocumentationAssetLoader
+{
+public:
+	static FDocumentationAssetLoader& Get();
+
+	void Prefetch(const FString& Path);
+	void Open(const FString& Path, EAssetTypeActivationOpenedMethod Method);
+
+	void Shutdown();
+
+private:
+	struct FPendingLoad
+	{
+		FString ObjectPath;
+		TOptional<EAssetTypeActivationOpenedMethod> OpenMethod;
+		TSharedPtr<SNotificationItem> Notification;
+	};
+
+	/** Object path for asset path or package name */
+	static FString GetObjectPath(const FString& Path);
+
+	/**
+	 * Start or join async load of package of ObjectPath. OpenMethod is set before load starts,
+	 * so asset opens even when completion runs inside LoadPackageAsync. Returns null in that case
+	 */
+	FPendingLoad* StartLoad(const FString& ObjectPath, TOptional<EAssetTypeActivationOpenedMethod> OpenMethod = {});
+	void OnPackageLoaded(const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result);
+	void KeepAlive(UPackage* Package);
+
+	TMap<FName, FPendingLoad> PendingLoads;
+	TArray<TStrongObjectPtr<UPackage>> RecentPackages;
+};
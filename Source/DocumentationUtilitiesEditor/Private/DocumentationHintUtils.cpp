@@ -0,0 +1,175 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "DocumentationHintUtils.h"
+#include "HintStruct.h"
+
+#include <AssetRegistry/IAssetRegistry.h>
+#include <UObject/PropertyIterator.h>
+#include <UObject/StructOnScope.h>
+#include <UObject/UObjectIterator.h>
+#include <UObject/Package.h>
+
+
+namespace DocumentationHintUtils
+{
+	void ForEachDefaultHint(const UStruct* Type, TFunctionRef<void(const FStructProperty* Property, const FHintStruct& Hint)> Visitor)
+	{
+		const void* DefaultValue = nullptr;
+		TOptional<FStructOnScope> DefaultStruct;
+
+		for (TFieldIterator<FStructProperty> PropertyIt(Type, EFieldIteratorFlags::IncludeSuper); PropertyIt; ++PropertyIt)
+		{
+			const FStructProperty* Prop = *PropertyIt;
+			if (Prop->Struct != FHintStruct::StaticStruct())
+			{
+				continue;
+			}
+
+			// Default value is created only for types that have hints
+			if (DefaultValue == nullptr)
+			{
+				if (const UClass* Class = Cast<UClass>(Type))
+				{
+					DefaultValue = Class->GetDefaultObject();
+				}
+				else if (const UScriptStruct* Struct = Cast<UScriptStruct>(Type))
+				{
+					DefaultStruct.Emplace(Struct);
+					DefaultValue = DefaultStruct->GetStructMemory();
+				}
+
+				if (DefaultValue == nullptr)
+				{
+					return;
+				}
+			}
+
+			if (const FHintStruct* Value = Prop->ContainerPtrToValuePtr<FHintStruct>(DefaultValue))
+			{
+				Visitor(Prop, *Value);
+			}
+		}
+	}
+
+	void ForEachTypeDefaultHint(TFunctionRef<void(const UStruct* Type, const FStructProperty* Property, const FHintStruct& Hint)> Visitor)
+	{
+		for (TObjectIterator<UClass> ClassIt; ClassIt; ++ClassIt)
+		{
+			const UClass* Class = *ClassIt;
+			ForEachDefaultHint(Class, [Class, &Visitor](const FStructProperty* Property, const FHintStruct& Hint) { Visitor(Class, Property, Hint); });
+		}
+
+		for (TObjectIterator<UScriptStruct> StructIt; StructIt; ++StructIt)
+		{
+			const UScriptStruct* Struct = *StructIt;
+			ForEachDefaultHint(Struct, [Struct, &Visitor](const FStructProperty* Property, const FHintStruct& Hint) { Visitor(Struct, Property, Hint); });
+		}
+	}
+
+	void ForEachObjectHint(UObject* Object, TFunctionRef<void(const FProperty* Property, FHintStruct& Hint)> Visitor)
+	{
+		if (Object == nullptr)
+		{
+			return;
+		}
+
+		for (FPropertyValueIterator It(FStructProperty::StaticClass(), Object->GetClass(), Object); It; ++It)
+		{
+			const FStructProperty* Prop = CastFieldChecked<FStructProperty>(It.Key());
+			if (Prop->Struct == FHintStruct::StaticStruct())
+			{
+				Visitor(Prop, *static_cast<FHintStruct*>(const_cast<void*>(It.Value())));
+				It.SkipRecursiveProperty();
+			}
+		}
+	}
+
+	void ForEachAssetHintLink(const IAssetRegistry& AssetRegistry, TFunctionRef<void(FName PackageName, const FString& LinkKey)> Visitor, const std::atomic<bool>* bCancel)
+	{
+		// FHintStruct marks its link as searchable name on save, so registry knows every key without loading the package
+		const FName HintStructPackage = FHintStruct::StaticStruct()->GetOutermost()->GetFName();
+		const FName HintStructName = FHintStruct::StaticStruct()->GetFName();
+
+		TSet<FName> PackageNames;
+		{
+			TArray<FAssetData> Assets;
+			AssetRegistry.GetAllAssets(Assets, true);
+			for (const FAssetData& AssetData : Assets)
+			{
+				PackageNames.Add(AssetData.PackageName);
+			}
+		}
+
+		TArray<FAssetIdentifier> Dependencies;
+		for (const FName& PackageName : PackageNames)
+		{
+			if (bCancel != nullptr && *bCancel)
+			{
+				return;
+			}
+
+			Dependencies.Reset();
+			AssetRegistry.GetDependencies(FAssetIdentifier(PackageName), Dependencies, UE::AssetRegistry::EDependencyCategory::SearchableName);
+
+			for (const FAssetIdentifier& Dependency : Dependencies)
+			{
+				if (Dependency.PackageName == HintStructPackage && Dependency.ObjectName == HintStructName && !Dependency.ValueName.IsNone())
+				{
+					Visitor(PackageName, Dependency.ValueName.ToString());
+				}
+			}
+		}
+	}
+
+	void GetAssetHintLinkReferencers(const IAssetRegistry& AssetRegistry, const FString& LinkKey, TArray<FName>& OutPackageNames)
+	{
+		// Registry keeps reverse index of searchable names, same data as ForEachAssetHintLink
+		const FAssetIdentifier LinkIdentifier(FHintStruct::StaticStruct(), *LinkKey);
+
+		TArray<FAssetIdentifier> Referencers;
+		AssetRegistry.GetReferencers(LinkIdentifier, Referencers, UE::AssetRegistry::EDependencyCategory::SearchableName);
+
+		for (const FAssetIdentifier& Referencer : Referencers)
+		{
+			if (!Referencer.PackageName.IsNone())
+			{
+				OutPackageNames.AddUnique(Referencer.PackageName);
+			}
+		}
+	}
+
+	FString GetHintText(EHintSource Source, const FString& Value, const FProperty* Property, const UStruct* Type)
+	{
+		switch (Source)
+		{
+		case EHintSource::PropertyValue:
+			return Value;
+		case EHintSource::PropertyTooltip:
+			return Property ? Property->GetToolTipText().ToString() : FString();
+		case EHintSource::ClassTooltip:
+			return Type ? Type->GetToolTipText().ToString() : FString();
+		case EHintSource::FirstValidTooltip:
+			for (const UStruct* Super = Type; Super != nullptr; Super = Super->GetSuperStruct())
+			{
+				const FText Tooltip = Super->GetToolTipText();
+				if (!Tooltip.IsEmpty() && !Tooltip.EqualToCaseIgnored(Super->GetDisplayNameText()))
+				{
+					return Tooltip.ToString();
+				}
+			}
+			break;
+		case EHintSource::NativeClassTooltip:
+			for (const UStruct* Super = Type; Super != nullptr; Super = Super->GetSuperStruct())
+			{
+				if (Super->GetPackage()->HasAnyPackageFlags(PKG_CompiledIn))
+				{
+					return Super->GetToolTipText().ToString();
+				}
+			}
+			break;
+		case EHintSource::MAX:
+			break;
+		}
+		return FString();
+	}
+}
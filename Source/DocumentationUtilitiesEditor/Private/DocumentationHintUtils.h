@@ -0,0 +1,32 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+struct FHintStruct;
+class IAssetRegistry;
+enum class EHintSource : uint8;
+
+namespace DocumentationHintUtils
+{
+	/** Visit FHintStruct properties in default value of class or script struct, including inherited ones */
+	void ForEachDefaultHint(const UStruct* Type, TFunctionRef<void(const FStructProperty* Property, const FHintStruct& Hint)> Visitor);
+
+	/** Visit defaults of every class and script struct in memory */
+	void ForEachTypeDefaultHint(TFunctionRef<void(const UStruct* Type, const FStructProperty* Property, const FHintStruct& Hint)> Visitor);
+
+	/** Visit every FHintStruct inside object, including nested structs and containers */
+	void ForEachObjectHint(UObject* Object, TFunctionRef<void(const FProperty* Property, FHintStruct& Hint)> Visitor);
+
+	/** Text of hint or tooltip without widgets. Type is owner class or struct of the property */
+	FString GetHintText(EHintSource Source, const FString& Value, const FProperty* Property, const UStruct* Type);
+
+	/** Visit links saved by FHintStruct as searchable names. Does not load packages. Stops between packages once bCancel is set */
+	void ForEachAssetHintLink(const IAssetRegistry& AssetRegistry, TFunctionRef<void(FName PackageName, const FString& LinkKey)> Visitor, const std::atomic<bool>* bCancel = nullptr);
+
+	/** Packages with saved FHintStruct that links to LinkKey. Does not load packages */
+	void GetAssetHintLinkReferencers(const IAssetRegistry& AssetRegistry, const FString& LinkKey, TArray<FName>& OutPackageNames);
+}
@@ -0,0 +1,336 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "DocumentationLinkFixup.h"
+#include "DocumentationUtilitiesSettings.h"
+#include "DocumentationLinkSnapshot.h"
+#include "DocumentationHintUtils.h"
+#include "DocumentationUtilitiesMemory.h"
+#include "HintStruct.h"
+
+#include <AssetRegistry/AssetRegistryModule.h>
+#include <Editor.h>
+#include <FileHelpers.h>
+#include <UObject/Package.h>
+#include <UObject/UObjectHash.h>
+
+DEFINE_LOG_CATEGORY_STATIC(LogDocumentationLinkFixup, Log, All);
+
+
+
+namespace DocumentationLinkFixup
+{
+	/** Seconds per frame spent loading and fixing packages */
+	static constexpr double FrameBudget = 0.005;
+
+	/** Fixed packages are saved together when this many are dirty */
+	static constexpr int32 SaveBatchSize = 32;
+
+	static bool RenameEntry(FDocumentationHintLink& Entry, const FString& NewKey)
+	{
+		switch (Entry.Type)
+		{
+		case EDocumentationLinkType::Asset:
+			Entry.AssetKey = TSoftObjectPtr<UObject>(FSoftObjectPath(NewKey));
+			return true;
+		case EDocumentationLinkType::Class:
+			Entry.ClassKey = TSoftClassPtr<UObject>(FSoftObjectPath(NewKey));
+			return true;
+		case EDocumentationLinkType::String:
+			Entry.StringKey = NewKey;
+			return true;
+		case EDocumentationLinkType::Native:
+		case EDocumentationLinkType::AssetHint:
+		case EDocumentationLinkType::MAX:
+			break;
+		}
+		return false;
+	}
+}
+
+FDocumentationLinkFixup& FDocumentationLinkFixup::Get()
+{
+	static FDocumentationLinkFixup Instance;
+	return Instance;
+}
+
+void FDocumentationLinkFixup::Initialize()
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRegistry.OnAssetRenamed().AddRaw(this, &FDocumentationLinkFixup::OnAssetRenamed);
+	AssetRegistry.OnAssetRemoved().AddRaw(this, &FDocumentationLinkFixup::OnAssetRemoved);
+}
+
+void FDocumentationLinkFixup::Shutdown()
+{
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+	{
+		AssetRegistryModule->Get().OnAssetRenamed().RemoveAll(this);
+		AssetRegistryModule->Get().OnAssetRemoved().RemoveAll(this);
+	}
+
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+
+	PendingRenames.Empty();
+	ActiveRenames.Empty();
+	PackageQueue.Empty();
+	QueuedPackages.Empty();
+	PackagesToSave.Empty();
+	KeyIndex.Empty();
+	KeyIndexSerial = 0;
+}
+
+void FDocumentationLinkFixup::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+
+	const FString NewObjectPath = AssetData.GetSoftObjectPath().ToString();
+	PendingRenames.Add(OldObjectPath, NewObjectPath);
+
+	// Class links of Blueprints use generated class path
+	PendingRenames.Add(OldObjectPath + TEXT("_C"), NewObjectPath + TEXT("_C"));
+
+	RequestTick();
+}
+
+void FDocumentationLinkFixup::OnAssetRemoved(const FAssetData& AssetData)
+{
+	UpdateKeyIndex();
+
+	const FString ObjectPath = AssetData.GetSoftObjectPath().ToString();
+	const TArray<FEntryRef>* Entries = KeyIndex.Find(ObjectPath);
+	if (Entries && Entries->Num() > 0)
+	{
+		UE_LOG(LogDocumentationLinkFixup, Warning, TEXT("%d documentation link(s) use deleted asset %s as key"), Entries->Num(), *ObjectPath);
+	}
+}
+
+void FDocumentationLinkFixup::RequestTick()
+{
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FDocumentationLinkFixup::Tick));
+	}
+}
+
+bool FDocumentationLinkFixup::Tick(float DeltaTime)
+{
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+
+	if (PendingRenames.Num() > 0)
+	{
+		const TMap<FString, FString> Renames = MoveTemp(PendingRenames);
+		PendingRenames.Reset();
+
+		FixSettingsLinks(Renames);
+		QueueHintOwners(Renames);
+	}
+
+	// Packages are not saved while playing, fixed ones wait dirty
+	if (GEditor && GEditor->PlayWorld)
+	{
+		return true;
+	}
+
+	const bool bQueueEmpty = ProcessPackages(DocumentationLinkFixup::FrameBudget);
+	if (PackagesToSave.Num() >= DocumentationLinkFixup::SaveBatchSize || (bQueueEmpty && PackagesToSave.Num() > 0))
+	{
+		SavePackages();
+	}
+
+	if (bQueueEmpty && PendingRenames.Num() == 0)
+	{
+		ActiveRenames.Empty();
+		TickerHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+void FDocumentationLinkFixup::UpdateKeyIndex()
+{
+	FDocumentationLinkReadScope Snapshot;
+	if (Snapshot->GetSerial() == KeyIndexSerial)
+	{
+		return;
+	}
+	KeyIndexSerial = Snapshot->GetSerial();
+
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+
+	// Native and AssetHint entries are regenerated from code and assets, only user entries are fixed
+	UDocumentationUtilities* Settings = GetMutableDefault<UDocumentationUtilities>();
+	KeyIndex.Reset();
+	for (TArray<FDocumentationHintLink>* Source : { &Settings->Links, &Settings->LinksOverride })
+	{
+		for (int32 Index = 0; Index < Source->Num(); Index++)
+		{
+			KeyIndex.FindOrAdd((*Source)[Index].GetLinkKey()).Add({ Source, Index, nullptr });
+		}
+	}
+
+	// Table loads and edits rebuild snapshot, so serial check covers them too
+	for (UDocumentationLinkTableAsset* Table : Settings->GetLoadedLinkTables())
+	{
+		if (Table)
+		{
+			for (int32 Index = 0; Index < Table->Links.Num(); Index++)
+			{
+				KeyIndex.FindOrAdd(Table->Links[Index].GetLinkKey()).Add({ &Table->Links, Index, Table });
+			}
+		}
+	}
+}
+
+void FDocumentationLinkFixup::FixSettingsLinks(const TMap<FString, FString>& Renames)
+{
+	UpdateKeyIndex();
+
+	int32 NumFixed = 0;
+	bool bSettingsChanged = false;
+	TMap<UObject*, bool> FixedTables;
+	for (const TPair<FString, FString>& Rename : Renames)
+	{
+		if (const TArray<FEntryRef>* Entries = KeyIndex.Find(Rename.Key))
+		{
+			for (const FEntryRef& Entry : *Entries)
+			{
+				UObject* Owner = Entry.Owner.Get();
+				if (Entry.Owner.IsStale())
+				{
+					continue;
+				}
+				if (Owner && !FixedTables.Contains(Owner))
+				{
+					FixedTables.Add(Owner, Owner->GetPackage()->IsDirty());
+					Owner->Modify();
+				}
+
+				if (DocumentationLinkFixup::RenameEntry((*Entry.Source)[Entry.Index], Rename.Value))
+				{
+					NumFixed++;
+					bSettingsChanged |= Owner == nullptr;
+				}
+			}
+		}
+	}
+
+	for (const TPair<UObject*, bool>& Table : FixedTables)
+	{
+		MarkFixed(Table.Key->GetPackage(), Table.Value);
+	}
+
+	if (NumFixed > 0)
+	{
+		UDocumentationUtilities* Settings = GetMutableDefault<UDocumentationUtilities>();
+		Settings->RebuildLinkSnapshot();
+		if (bSettingsChanged)
+		{
+			Settings->TryUpdateDefaultConfigFile();
+		}
+
+		UE_LOG(LogDocumentationLinkFixup, Display, TEXT("Updated %d documentation link key(s) after asset rename"), NumFixed);
+	}
+}
+
+void FDocumentationLinkFixup::QueueHintOwners(const TMap<FString, FString>& Renames)
+{
+	const IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	TArray<FName> PackageNames;
+	for (const TPair<FString, FString>& Rename : Renames)
+	{
+		PackageNames.Reset();
+		DocumentationHintUtils::GetAssetHintLinkReferencers(AssetRegistry, Rename.Key, PackageNames);
+		if (PackageNames.Num() == 0)
+		{
+			continue;
+		}
+
+		ActiveRenames.Add(Rename.Key, Rename.Value);
+		for (const FName& PackageName : PackageNames)
+		{
+			if (!QueuedPackages.Contains(PackageName))
+			{
+				QueuedPackages.Add(PackageName);
+				PackageQueue.Add(PackageName);
+			}
+		}
+	}
+}
+
+bool FDocumentationLinkFixup::ProcessPackages(double TimeBudget)
+{
+	const double EndTime = FPlatformTime::Seconds() + TimeBudget;
+	while (PackageQueue.Num() > 0 && FPlatformTime::Seconds() < EndTime)
+	{
+		const FName PackageName = PackageQueue.Pop(false);
+		QueuedPackages.Remove(PackageName);
+
+		UPackage* Package = FindPackage(nullptr, *PackageName.ToString());
+		if (Package == nullptr)
+		{
+			Package = LoadPackage(nullptr, *PackageName.ToString(), LOAD_None);
+		}
+		if (Package == nullptr)
+		{
+			continue;
+		}
+
+		const bool bWasDirty = Package->IsDirty();
+		bool bChanged = false;
+		TArray<UObject*> Objects;
+		// Actors have level as outer, component templates and subobjects are nested too
+		GetObjectsWithPackage(Package, Objects, true);
+		for (UObject* Object : Objects)
+		{
+			DocumentationHintUtils::ForEachObjectHint(Object, [this, Object, &bChanged](const FProperty* Property, FHintStruct& Hint)
+			{
+				const FString* NewPath = Hint.IsObjectLink() ? ActiveRenames.Find(Hint.LinkAddressPath.ToString()) : nullptr;
+				if (NewPath)
+				{
+					Object->Modify();
+					Hint.LinkAddressPath = FSoftObjectPath(*NewPath);
+					bChanged = true;
+				}
+			});
+		}
+
+		if (bChanged)
+		{
+			MarkFixed(Package, bWasDirty);
+		}
+	}
+	return PackageQueue.Num() == 0;
+}
+
+void FDocumentationLinkFixup::MarkFixed(UPackage* Package, bool bWasDirty)
+{
+	// Packages fixed earlier in this batch are dirty because of us, they are still saved
+	Package->MarkPackageDirty();
+	if (bWasDirty && !PackagesToSave.Contains(Package))
+	{
+		UE_LOG(LogDocumentationLinkFixup, Display, TEXT("Updated hint links in %s, package had unsaved changes and was left dirty"), *Package->GetName());
+		return;
+	}
+	PackagesToSave.AddUnique(Package);
+}
+
+void FDocumentationLinkFixup::SavePackages()
+{
+	TArray<UPackage*> Packages;
+	for (const TWeakObjectPtr<UPackage>& Package : PackagesToSave)
+	{
+		if (Package.IsValid())
+		{
+			Packages.Add(Package.Get());
+		}
+	}
+	PackagesToSave.Reset();
+
+	if (Packages.Num() > 0)
+	{
+		UEditorLoadingAndSavingUtils::SavePackages(Packages, true);
+		UE_LOG(LogDocumentationLinkFixup, Display, TEXT("Saved %d package(s) with updated hint links"), Packages.Num());
+	}
+}
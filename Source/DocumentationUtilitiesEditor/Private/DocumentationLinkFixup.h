@@ -0,0 +1,76 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+struct FAssetData;
+struct FDocumentationHintLink;
+
+/**
+ * Keeps links pointing at assets valid when assets are renamed or moved
+ *
+ * Settings entries are found through key index, rebuilt only when link snapshot changes
+ * Packages with FHintStruct linking to old path are found through asset registry searchable names,
+ * then loaded, fixed and saved in batches over several frames
+ *
+ * Entries of loaded link table assets are fixed the same way
+ *
+ * Only packages that were clean before the fix are saved, already dirty ones are left dirty
+ * so unrelated unsaved changes are not committed behind the user's back
+ *
+ * Renames of one frame are applied together, so folder move writes config once
+ * Deleted assets are only reported, entries are kept for link GC report
+ * Game thread only
+ */
+class FDocumentationLinkFixup
+{
+public:
+	static FDocumentationLinkFixup& Get();
+
+	void Initialize();
+	void Shutdown();
+
+private:
+	struct FEntryRef
+	{
+		TArray<FDocumentationHintLink>* Source;
+		int32 Index;
+		/** Link table asset that owns Source, null for settings */
+		TWeakObjectPtr<UObject> Owner;
+	};
+
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+	void OnAssetRemoved(const FAssetData& AssetData);
+
+	bool Tick(float DeltaTime);
+	void RequestTick();
+
+	void UpdateKeyIndex();
+	void FixSettingsLinks(const TMap<FString, FString>& Renames);
+	void QueueHintOwners(const TMap<FString, FString>& Renames);
+
+	/** Returns true when package queue is empty */
+	bool ProcessPackages(double TimeBudget);
+	void SavePackages();
+
+	/** Dirty package after fix, and queue it for saving if it had no unsaved changes */
+	void MarkFixed(UPackage* Package, bool bWasDirty);
+
+	/** Old object path to new, collected until next tick */
+	TMap<FString, FString> PendingRenames;
+
+	/** Renames applied to queued packages */
+	TMap<FString, FString> ActiveRenames;
+
+	TArray<FName> PackageQueue;
+	TSet<FName> QueuedPackages;
+	TArray<TWeakObjectPtr<UPackage>> PackagesToSave;
+
+	/** Editable settings entries by link key */
+	TMap<FString, TArray<FEntryRef>> KeyIndex;
+	uint64 KeyIndexSerial = 0;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -0,0 +1,254 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "DocumentationLinkGC.h"
+#include "DocumentationUtilitiesSettings.h"
+#include "DocumentationLinkSnapshot.h"
+#include "DocumentationHintUtils.h"
+#include "DocumentationUtilitiesMemory.h"
+
+#include <AssetRegistry/IAssetRegistry.h>
+#include <Async/Async.h>
+
+DEFINE_LOG_CATEGORY_STATIC(LogDocumentationLinkGC, Log, All);
+
+
+
+namespace DocumentationLinkGC
+{
+	/** Asset or Blueprint of class key is known to asset registry */
+	static bool DoesAssetExist(const IAssetRegistry& AssetRegistry, FString Path, bool bIsClass)
+	{
+		if (bIsClass)
+		{
+			Path.RemoveFromEnd(TEXT("_C"));
+		}
+
+		const FSoftObjectPath ObjectPath(Path);
+		return !ObjectPath.IsNull() && AssetRegistry.GetAssetByObjectPath(ObjectPath, true).IsValid();
+	}
+}
+
+FDocumentationLinkGC& FDocumentationLinkGC::Get()
+{
+	static FDocumentationLinkGC Instance;
+	return Instance;
+}
+
+void FDocumentationLinkGC::Start()
+{
+	check(IsInGameThread());
+
+	if (BuildTask.IsValid())
+	{
+		return;
+	}
+
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+
+	bCancel = false;
+	BuildTask = Async(EAsyncExecution::ThreadPool, [this, Input = CollectInput()]() mutable
+	{
+		LLM_SCOPE_BYTAG(DocumentationUtilities);
+		return BuildReport(MoveTemp(Input), bCancel);
+	});
+
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FDocumentationLinkGC::Tick));
+	}
+}
+
+void FDocumentationLinkGC::Shutdown()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+
+	if (BuildTask.IsValid())
+	{
+		bCancel = true;
+		BuildTask.Wait();
+		BuildTask.Reset();
+	}
+	Report.Reset();
+}
+
+bool FDocumentationLinkGC::Tick(float DeltaTime)
+{
+	if (!BuildTask.IsValid() || !BuildTask.IsReady())
+	{
+		return true;
+	}
+
+	Report = BuildTask.Get();
+	BuildTask.Reset();
+	TickerHandle.Reset();
+
+	if (Report.IsValid())
+	{
+		UE_LOG(LogDocumentationLinkGC, Display, TEXT("Link GC: %d unused, %d unreferenced string, %d dangling, %d packages scanned in %.2fs"),
+			Report->UnusedKeys.Num(), Report->UnreferencedStringKeys.Num(), Report->DanglingKeys.Num(), Report->NumScannedPackages, Report->Seconds);
+	}
+	OnReportReady.Broadcast();
+	return false;
+}
+
+FDocumentationLinkGC::FInput FDocumentationLinkGC::CollectInput()
+{
+	// Native keys must be complete, otherwise their entries would be reported as unused
+	UDocumentationUtilities::EnsureNativeLinksCollected();
+
+	const UDocumentationUtilities* Settings = GetDefault<UDocumentationUtilities>();
+
+	FInput Input;
+	Input.UserLinks.Reserve(Settings->Links.Num());
+	for (const FDocumentationHintLink& Link : Settings->Links)
+	{
+		const FString Key = Link.GetLinkKey();
+		Input.UserLinks.Emplace(Key, Link.Type);
+
+		if (Link.Type == EDocumentationLinkType::Class && Link.ClassKey.Get() != nullptr)
+		{
+			Input.LoadedClassKeys.Add(Key);
+		}
+	}
+
+	Input.NativeKeys.Reserve(Settings->NativeLinks.Num());
+	for (const FDocumentationHintLink& Link : Settings->NativeLinks)
+	{
+		Input.NativeKeys.Add(Link.GetLinkKey());
+	}
+
+	{
+		FDocumentationLinkReadScope Snapshot;
+		Input.SnapshotSerial = Snapshot->GetSerial();
+		Input.ResolvedKeys.Reserve(Snapshot->Num());
+		Snapshot->ForEachLink([&Input](const FString& Key, const FString& Value)
+		{
+			Input.ResolvedKeys.Add(Key);
+		});
+	}
+
+	if (const IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+	{
+		Input.bAssetRegistryLoading = AssetRegistry->IsLoadingAssets();
+	}
+	return Input;
+}
+
+FDocumentationLinkGC::FReportPtr FDocumentationLinkGC::BuildReport(FInput Input, const std::atomic<bool>& bCancel)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	TSharedRef<FDocumentationLinkGCReport, ESPMode::ThreadSafe> NewReport = MakeShared<FDocumentationLinkGCReport, ESPMode::ThreadSafe>();
+	NewReport->bIncomplete = Input.bAssetRegistryLoading;
+	NewReport->SnapshotSerial = Input.SnapshotSerial;
+
+	const IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+	if (AssetRegistry == nullptr)
+	{
+		return nullptr;
+	}
+
+	// Key -> first referencing package and count
+	TMap<FString, TPair<FName, int32>> HintKeys;
+	TSet<FName> Packages;
+	DocumentationHintUtils::ForEachAssetHintLink(*AssetRegistry, [&HintKeys, &Packages](FName PackageName, const FString& LinkKey)
+	{
+		TPair<FName, int32>& Entry = HintKeys.FindOrAdd(LinkKey, TPair<FName, int32>(PackageName, 0));
+		Entry.Value++;
+		Packages.Add(PackageName);
+	}, &bCancel);
+	NewReport->NumScannedPackages = Packages.Num();
+
+	if (bCancel)
+	{
+		return nullptr;
+	}
+
+	TSet<FString> UnusedKeys;
+	TSet<FString> UnreferencedStringKeys;
+	for (const TPair<FString, EDocumentationLinkType>& Link : Input.UserLinks)
+	{
+		const FString& Key = Link.Key;
+		if (Key.IsEmpty() || Input.NativeKeys.Contains(Key) || HintKeys.Contains(Key))
+		{
+			continue;
+		}
+
+		// Asset and Class entries document their target, they are unused only when target is gone
+		switch (Link.Value)
+		{
+		case EDocumentationLinkType::Asset:
+			if (!DocumentationLinkGC::DoesAssetExist(*AssetRegistry, Key, false))
+			{
+				UnusedKeys.Add(Key);
+			}
+			break;
+		case EDocumentationLinkType::Class:
+			if (!Input.LoadedClassKeys.Contains(Key) && !DocumentationLinkGC::DoesAssetExist(*AssetRegistry, Key, true))
+			{
+				UnusedKeys.Add(Key);
+			}
+			break;
+		case EDocumentationLinkType::String:
+			UnreferencedStringKeys.Add(Key);
+			break;
+		case EDocumentationLinkType::Native:
+		case EDocumentationLinkType::AssetHint:
+		case EDocumentationLinkType::MAX:
+			break;
+		}
+	}
+	NewReport->UnusedKeys = UnusedKeys.Array();
+	NewReport->UnreferencedStringKeys = UnreferencedStringKeys.Array();
+
+	for (const TPair<FString, TPair<FName, int32>>& HintKey : HintKeys)
+	{
+		if (!Input.ResolvedKeys.Contains(HintKey.Key))
+		{
+			NewReport->DanglingKeys.Add({ HintKey.Key, HintKey.Value.Key, HintKey.Value.Value });
+		}
+	}
+	for (const FString& NativeKey : Input.NativeKeys)
+	{
+		if (!Input.ResolvedKeys.Contains(NativeKey) && !HintKeys.Contains(NativeKey))
+		{
+			NewReport->DanglingKeys.Add({ NativeKey, NAME_None, 0 });
+		}
+	}
+
+	NewReport->UnusedKeys.Sort();
+	NewReport->UnreferencedStringKeys.Sort();
+	NewReport->DanglingKeys.Sort([](const FDocumentationLinkGCReport::FDanglingKey& A, const FDocumentationLinkGCReport::FDanglingKey& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	NewReport->Seconds = FPlatformTime::Seconds() - StartTime;
+	return NewReport;
+}
+
+bool FDocumentationLinkGC::CanPrune() const
+{
+	if (!Report.IsValid() || Report->bIncomplete || Report->UnusedKeys.Num() == 0 || IsRunning())
+	{
+		return false;
+	}
+
+	FDocumentationLinkReadScope Snapshot;
+	return Snapshot->GetSerial() == Report->SnapshotSerial;
+}
+
+int32 FDocumentationLinkGC::PruneUnused()
+{
+	if (!CanPrune())
+	{
+		return 0;
+	}
+
+	const int32 NumRemoved = GetMutableDefault<UDocumentationUtilities>()->EditLinks({}, Report->UnusedKeys);
+	UE_LOG(LogDocumentationLinkGC, Display, TEXT("Link GC: removed %d unused link(s)"), NumRemoved);
+
+	Start();
+	return NumRemoved;
+}
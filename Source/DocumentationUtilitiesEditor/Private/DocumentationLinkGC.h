@@ -0,0 +1,110 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Async/Future.h"
+
+#include <atomic>
+
+enum class EDocumentationLinkType : uint8;
+
+/** Result of link garbage collection scan */
+struct FDocumentationLinkGCReport
+{
+	struct FDanglingKey
+	{
+		FString Key;
+		/** One of packages that saved hint with this key, None for native types */
+		FName Referencer;
+		int32 NumReferencers = 0;
+	};
+
+	/** Asset and Class entries of Links that nothing uses and whose target no longer exists. Safe to prune */
+	TArray<FString> UnusedKeys;
+
+	/**
+	 * String entries of Links with no hint or native type saving their key
+	 * Not pruned: markdown links in hint text and OpenLink calls in code are not tracked by asset registry
+	 */
+	TArray<FString> UnreferencedStringKeys;
+
+	/** Keys used by hints or native types that have no value in any link source */
+	TArray<FDanglingKey> DanglingKeys;
+
+	int32 NumScannedPackages = 0;
+
+	/** Asset registry was still scanning, report can miss referencers */
+	bool bIncomplete = false;
+
+	/** Serial of link snapshot the report was built from */
+	uint64 SnapshotSerial = 0;
+
+	double Seconds = 0.0;
+};
+
+/**
+ * Finds unused entries of Links and hint keys without link value
+ *
+ * Settings, native keys and snapshot are copied on game thread, asset registry searchable names
+ * are read on worker thread. Both sets are hash lookups, so scan is linear in packages and links
+ * Game thread only
+ */
+class FDocumentationLinkGC
+{
+public:
+	using FReportPtr = TSharedPtr<const FDocumentationLinkGCReport, ESPMode::ThreadSafe>;
+
+	static FDocumentationLinkGC& Get();
+
+	/** Start new scan. Ignored while scan is running */
+	void Start();
+
+	/** Cancel running scan and drop report */
+	void Shutdown();
+
+	bool IsRunning() const { return BuildTask.IsValid(); }
+
+	/** Last finished report, null before first scan */
+	FReportPtr GetReport() const { return Report; }
+
+	/** Last report is complete and settings did not change since it was built */
+	bool CanPrune() const;
+
+	/** Remove unused keys of last report from Links in one transaction, then scan again. Returns number of removed entries */
+	int32 PruneUnused();
+
+	/** Broadcast when scan finishes */
+	FSimpleMulticastDelegate OnReportReady;
+
+private:
+	struct FInput
+	{
+		/** Key and type of each Links entry */
+		TArray<TPair<FString, EDocumentationLinkType>> UserLinks;
+
+		/** Keys of native types, including registered native links */
+		TSet<FString> NativeKeys;
+
+		/** Keys with value in snapshot */
+		TSet<FString> ResolvedKeys;
+
+		/** Class keys that are loaded, the rest are looked up in asset registry */
+		TSet<FString> LoadedClassKeys;
+
+		bool bAssetRegistryLoading = false;
+		uint64 SnapshotSerial = 0;
+	};
+
+	static FInput CollectInput();
+	static FReportPtr BuildReport(FInput Input, const std::atomic<bool>& bCancel);
+
+	bool Tick(float DeltaTime);
+
+	FReportPtr Report;
+	TFuture<FReportPtr> BuildTask;
+	std::atomic<bool> bCancel = false;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+};
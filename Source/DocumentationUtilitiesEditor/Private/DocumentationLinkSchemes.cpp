@@ -0,0 +1,131 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "DocumentationLinkSchemes.h"
+#include "DocumentationUtilitiesMemory.h"
+
+
+namespace DocumentationLinkSchemes
+{
+	/** Addresses come from link tables and manual input, bound the cache in case of generated ones */
+	static constexpr int32 MaxParsedLinks = 8192;
+}
+
+const FName FDocumentationLinkSchemes::PathScheme = TEXT("View");
+
+
+FDocumentationLinkSchemes& FDocumentationLinkSchemes::Get()
+{
+	static FDocumentationLinkSchemes Instance;
+	return Instance;
+}
+
+void FDocumentationLinkSchemes::RegisterScheme(FName Scheme, const FDocumentationLinkScheme& Handler)
+{
+	check(IsInGameThread());
+	check(!Scheme.IsNone());
+
+	Schemes.Add(Scheme, Handler);
+	ParsedLinks.Reset();
+}
+
+void FDocumentationLinkSchemes::UnregisterScheme(FName Scheme)
+{
+	check(IsInGameThread());
+
+	if (Schemes.Remove(Scheme) > 0)
+	{
+		ParsedLinks.Reset();
+	}
+}
+
+const FDocumentationParsedLink& FDocumentationLinkSchemes::Parse(const FString& Address)
+{
+	check(IsInGameThread());
+
+	if (const FDocumentationParsedLink* Parsed = ParsedLinks.Find(Address))
+	{
+		return *Parsed;
+	}
+
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+
+	if (ParsedLinks.Num() >= DocumentationLinkSchemes::MaxParsedLinks)
+	{
+		ParsedLinks.Reset();
+	}
+	return ParsedLinks.Add(Address, ParseUncached(Address));
+}
+
+SIZE_T FDocumentationLinkSchemes::GetAllocatedSize() const
+{
+	SIZE_T Size = Schemes.GetAllocatedSize() + ParsedLinks.GetAllocatedSize();
+	for (const TPair<FString, FDocumentationParsedLink>& Pair : ParsedLinks)
+	{
+		Size += Pair.Key.GetAllocatedSize() + Pair.Value.Payload.GetAllocatedSize();
+	}
+	return Size;
+}
+
+bool FDocumentationLinkSchemes::Open(const FString& Address)
+{
+	// Copy: handler may register schemes and invalidate cache
+	const FDocumentationParsedLink Parsed = Parse(Address);
+	if (Parsed.IsValid())
+	{
+		if (const FDocumentationLinkScheme* Handler = Schemes.Find(Parsed.Scheme))
+		{
+			return Handler->OnOpen.ExecuteIfBound(Parsed.Payload);
+		}
+	}
+	return false;
+}
+
+void FDocumentationLinkSchemes::Prefetch(const FString& Address)
+{
+	const FDocumentationParsedLink Parsed = Parse(Address);
+	if (Parsed.IsValid())
+	{
+		if (const FDocumentationLinkScheme* Handler = Schemes.Find(Parsed.Scheme))
+		{
+			Handler->OnPrefetch.ExecuteIfBound(Parsed.Payload);
+		}
+	}
+}
+
+FDocumentationParsedLink FDocumentationLinkSchemes::ParseUncached(const FString& Address) const
+{
+	FDocumentationParsedLink Result;
+
+	FName SchemeName;
+	int32 PayloadStart = 0;
+	if (Address.StartsWith(TEXT("/")))
+	{
+		SchemeName = PathScheme;
+	}
+	else
+	{
+		int32 Separator = INDEX_NONE;
+		if (Address.FindChar(TEXT(':'), Separator) && Separator > 0)
+		{
+			// Do not pollute name table with arbitrary prefixes
+			SchemeName = FName(Separator, *Address, FNAME_Find);
+			PayloadStart = Separator + 1;
+		}
+	}
+
+	const FDocumentationLinkScheme* Handler = SchemeName.IsNone() ? nullptr : Schemes.Find(SchemeName);
+	if (Handler == nullptr)
+	{
+		return Result;
+	}
+
+	Result.Payload = Handler->bKeepPrefix ? Address : Address.Mid(PayloadStart);
+	if (Result.Payload.IsEmpty() || (Handler->OnValidate.IsBound() && !Handler->OnValidate.Execute(Result.Payload)))
+	{
+		Result.Payload.Reset();
+		return Result;
+	}
+
+	Result.Scheme = SchemeName;
+	return Result;
+}
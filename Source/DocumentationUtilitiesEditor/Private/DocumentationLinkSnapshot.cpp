@@ -0,0 +1,136 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "DocumentationLinkSnapshot.h"
+#include "DocumentationUtilitiesSettings.h"
+
+#include <Misc/PackageName.h>
+#include <Misc/ScopeLock.h>
+#include <HAL/PlatformProcess.h>
+
+#include <atomic>
+
+
+
+namespace DocumentationLinkSnapshot
+{
+	static const FDocumentationLinkSnapshot EmptySnapshot;
+
+	static std::atomic<const FDocumentationLinkSnapshot*> Current { &EmptySnapshot };
+
+	/** Readers register in slot selected by epoch parity, publisher flips epoch and drains old slot */
+	static std::atomic<uint32> Epoch { 0 };
+	static std::atomic<int32> Readers[2] = { {0}, {0} };
+
+	static FCriticalSection PublishLock;
+
+	static uint64 LastSerial = 0;
+
+	static void WaitForReaders()
+	{
+		// Reader that saw old snapshot may be registered in either slot, drain both
+		for (int32 Phase = 0; Phase < 2; Phase++)
+		{
+			const uint32 OldEpoch = Epoch.fetch_add(1);
+			while (Readers[OldEpoch & 1].load() != 0)
+			{
+				FPlatformProcess::Yield();
+			}
+		}
+	}
+}
+
+
+
+FDocumentationLinkReadScope::FDocumentationLinkReadScope()
+{
+	using namespace DocumentationLinkSnapshot;
+
+	ReaderSlot = Epoch.load() & 1;
+	Readers[ReaderSlot].fetch_add(1);
+	Snapshot = Current.load();
+}
+
+FDocumentationLinkReadScope::~FDocumentationLinkReadScope()
+{
+	DocumentationLinkSnapshot::Readers[ReaderSlot].fetch_sub(1);
+}
+
+
+
+TUniquePtr<FDocumentationLinkSnapshot> FDocumentationLinkSnapshot::Build(const UDocumentationUtilities& Settings)
+{
+	check(IsInGameThread());
+
+	TUniquePtr<FDocumentationLinkSnapshot> Snapshot = MakeUnique<FDocumentationLinkSnapshot>();
+	Snapshot->Serial = ++DocumentationLinkSnapshot::LastSerial;
+
+	TArray<const TArray<FDocumentationHintLink>*> Sources = Settings.GetSources();
+	for (const TArray<FDocumentationHintLink>* SourcePtr : Sources)
+	{
+		for (const FDocumentationHintLink& Link : *SourcePtr)
+		{
+			if (!Link.HasValue())
+			{
+				continue;
+			}
+
+			// Same priority as FindLinkByKey: first source with value wins
+			Snapshot->Links.FindOrAdd(Link.GetLinkKey(), Link.Value);
+
+			if (!Link.IsValid())
+			{
+				continue;
+			}
+
+			switch (Link.Type)
+			{
+			case EDocumentationLinkType::Asset:
+				Snapshot->DocumentedPaths.Add(Link.AssetKey.ToSoftObjectPath());
+				break;
+			case EDocumentationLinkType::Class:
+				Snapshot->DocumentedPaths.Add(Link.ClassKey.ToSoftObjectPath());
+				break;
+			case EDocumentationLinkType::String:
+			case EDocumentationLinkType::Native:
+			case EDocumentationLinkType::AssetHint:
+				if (FPackageName::IsValidObjectPath(Link.StringKey))
+				{
+					Snapshot->DocumentedPaths.Add(FSoftObjectPath(Link.StringKey));
+				}
+				break;
+			}
+		}
+	}
+
+	return Snapshot;
+}
+
+SIZE_T FDocumentationLinkSnapshot::GetAllocatedSize() const
+{
+	SIZE_T Size = Links.GetAllocatedSize() + DocumentedPaths.GetAllocatedSize();
+	for (const TPair<FString, FString>& Pair : Links)
+	{
+		Size += Pair.Key.GetAllocatedSize() + Pair.Value.GetAllocatedSize();
+	}
+	for (const FSoftObjectPath& Path : DocumentedPaths)
+	{
+		Size += Path.GetSubPathString().GetAllocatedSize();
+	}
+	return Size;
+}
+
+void FDocumentationLinkSnapshot::Publish(TUniquePtr<FDocumentationLinkSnapshot> Snapshot)
+{
+	using namespace DocumentationLinkSnapshot;
+
+	FScopeLock Lock(&PublishLock);
+
+	const FDocumentationLinkSnapshot* NewSnapshot = Snapshot.IsValid() ? Snapshot.Release() : &EmptySnapshot;
+	const FDocumentationLinkSnapshot* OldSnapshot = Current.exchange(NewSnapshot);
+
+	if (OldSnapshot != &EmptySnapshot && OldSnapshot != NewSnapshot)
+	{
+		WaitForReaders();
+		delete OldSnapshot;
+	}
+}
@@ -0,0 +1,126 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "DocumentationLinkTableCooker.h"
+#include "DocumentationLinkTable.h"
+#include "DocumentationLinkSnapshot.h"
+#include "DocumentationUtilitiesSettings.h"
+#include "DocumentationUtilitiesMemory.h"
+
+#include <HAL/FileManager.h>
+#include <Misc/FileHelper.h>
+#include <Misc/Paths.h>
+#include <Settings/ProjectPackagingSettings.h>
+
+DEFINE_LOG_CATEGORY_STATIC(LogDocumentationLinkTable, Log, All);
+
+
+
+namespace DocumentationLinkTableCooker
+{
+	/** Relative to Content, same as FDocumentationLinkTable::GetDefaultPath */
+	static const TCHAR* StagedDirectory = TEXT("DocumentationUtilities");
+}
+
+FDocumentationLinkTableCooker& FDocumentationLinkTableCooker::Get()
+{
+	static FDocumentationLinkTableCooker Instance;
+	return Instance;
+}
+
+void FDocumentationLinkTableCooker::Initialize()
+{
+	if (bIsInitialized)
+	{
+		return;
+	}
+	bIsInitialized = true;
+
+	FModifyCookDelegate& Delegate = FGameDelegates::Get().GetModifyCookDelegate();
+	PreviousDelegate = Delegate;
+	Delegate.BindRaw(this, &FDocumentationLinkTableCooker::OnModifyCook);
+}
+
+void FDocumentationLinkTableCooker::Shutdown()
+{
+	if (!bIsInitialized)
+	{
+		return;
+	}
+	bIsInitialized = false;
+
+	FModifyCookDelegate& Delegate = FGameDelegates::Get().GetModifyCookDelegate();
+	if (Delegate.IsBoundToObject(this))
+	{
+		Delegate = PreviousDelegate;
+	}
+	PreviousDelegate.Unbind();
+}
+
+void FDocumentationLinkTableCooker::OnModifyCook(TArray<FName>& PackagesToCook, TArray<FName>& PackagesToNeverCook)
+{
+	PreviousDelegate.ExecuteIfBound(PackagesToCook, PackagesToNeverCook);
+
+	const FString Path = FDocumentationLinkTable::GetDefaultPath();
+
+	const UDocumentationUtilities* Settings = GetDefault<UDocumentationUtilities>();
+	if (!Settings->bCookRuntimeLinkTable)
+	{
+		if (IFileManager::Get().FileExists(*Path))
+		{
+			IFileManager::Get().Delete(*Path, false, true, true);
+		}
+		return;
+	}
+
+	UDocumentationUtilities::EnsureNativeLinksCollected();
+	UDocumentationUtilities::EnsureLinkTablesLoaded();
+	WriteLinkTable(Path);
+}
+
+bool FDocumentationLinkTableCooker::WriteLinkTable(const FString& Path)
+{
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+
+	TMap<FString, FString> Links;
+	{
+		FDocumentationLinkReadScope Snapshot;
+		Links.Reserve(Snapshot->Num());
+		Snapshot->ForEachLink([&Links](const FString& Key, const FString& Value)
+		{
+			if (!Value.IsEmpty())
+			{
+				Links.Add(Key, Value);
+			}
+		});
+	}
+
+	TArray<uint8> Blob;
+	FDocumentationLinkTable::Write(Links, Blob);
+
+	if (!FFileHelper::SaveArrayToFile(Blob, *Path))
+	{
+		UE_LOG(LogDocumentationLinkTable, Error, TEXT("Failed to write link table %s"), *Path);
+		return false;
+	}
+
+	UE_LOG(LogDocumentationLinkTable, Display, TEXT("Wrote %d links to %s (%d bytes)"), Links.Num(), *Path, Blob.Num());
+	return true;
+}
+
+void FDocumentationLinkTableCooker::AddStagedDirectory()
+{
+	UProjectPackagingSettings* PackagingSettings = GetMutableDefault<UProjectPackagingSettings>();
+
+	const bool bIsStaged = PackagingSettings->DirectoriesToAlwaysStageAsNonUFS.ContainsByPredicate([](const FDirectoryPath& Directory)
+	{
+		return Directory.Path == DocumentationLinkTableCooker::StagedDirectory;
+	});
+
+	if (!bIsStaged)
+	{
+		FDirectoryPath Directory;
+		Directory.Path = DocumentationLinkTableCooker::StagedDirectory;
+		PackagingSettings->DirectoriesToAlwaysStageAsNonUFS.Add(Directory);
+		PackagingSettings->TryUpdateDefaultConfigFile();
+	}
+}
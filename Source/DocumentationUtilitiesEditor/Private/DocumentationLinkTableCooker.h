@@ -0,0 +1,33 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameDelegates.h"
+
+/**
+ * Writes FDocumentationLinkTable blob when cook starts, if enabled in settings
+ * Disabled setting removes blob left from previous cook, so stale links are not staged
+ *
+ * Chains to ModifyCookDelegate bound before it, delegate is single cast
+ */
+class FDocumentationLinkTableCooker
+{
+public:
+	static FDocumentationLinkTableCooker& Get();
+
+	void Initialize();
+	void Shutdown();
+
+	/** Write table from current link snapshot. Returns false if file could not be saved */
+	static bool WriteLinkTable(const FString& Path);
+
+	/** Add table directory to DirectoriesToAlwaysStageAsNonUFS, loose file can be memory mapped */
+	static void AddStagedDirectory();
+
+private:
+	void OnModifyCook(TArray<FName>& PackagesToCook, TArray<FName>& PackagesToNeverCook);
+
+	FModifyCookDelegate PreviousDelegate;
+	bool bIsInitialized = false;
+};
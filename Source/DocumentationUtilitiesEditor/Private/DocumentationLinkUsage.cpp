@@ -0,0 +1,217 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "DocumentationLinkUsage.h"
+#include "DocumentationUtilitiesMemory.h"
+
+#include <Async/Async.h>
+#include <Misc/FileHelper.h>
+#include <Misc/Paths.h>
+#include <Serialization/MemoryReader.h>
+#include <Serialization/MemoryWriter.h>
+
+
+
+namespace DocumentationLinkUsage
+{
+	static constexpr int32 FileVersion = 1;
+	static constexpr float FlushInterval = 30.f;
+}
+
+
+FDocumentationLinkUsage& FDocumentationLinkUsage::Get()
+{
+	static FDocumentationLinkUsage Instance;
+	return Instance;
+}
+
+void FDocumentationLinkUsage::Initialize()
+{
+	if (TickerHandle.IsValid())
+	{
+		return;
+	}
+
+	Load();
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FDocumentationLinkUsage::Tick), DocumentationLinkUsage::FlushInterval);
+}
+
+void FDocumentationLinkUsage::Shutdown()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+
+	Flush(true);
+}
+
+void FDocumentationLinkUsage::RecordClick(const FString& LinkKey)
+{
+	if (LinkKey.IsEmpty())
+	{
+		return;
+	}
+
+	const int64 Ticks = FDateTime::UtcNow().GetTicks();
+	if (IsInGameThread())
+	{
+		AddClick(LinkKey, Ticks);
+		return;
+	}
+
+	// Other threads never touch counters, game thread picks the click up later
+	PendingClicks.Enqueue({ LinkKey, Ticks });
+}
+
+void FDocumentationLinkUsage::AddClick(const FString& LinkKey, int64 Ticks)
+{
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+
+	FCounter& Counter = Counters.FindOrAdd(LinkKey);
+	Counter.Clicks++;
+	Counter.LastUsedTicks = FMath::Max(Counter.LastUsedTicks, Ticks);
+	bDirty = true;
+}
+
+void FDocumentationLinkUsage::DrainPending()
+{
+	check(IsInGameThread());
+
+	FPendingClick Click;
+	while (PendingClicks.Dequeue(Click))
+	{
+		AddClick(Click.LinkKey, Click.Ticks);
+	}
+}
+
+void FDocumentationLinkUsage::GetUsage(TArray<FUsage>& OutUsage)
+{
+	DrainPending();
+
+	OutUsage.Reset(Counters.Num());
+	for (const TPair<FString, FCounter>& Pair : Counters)
+	{
+		FUsage& Usage = OutUsage.AddDefaulted_GetRef();
+		Usage.LinkKey = Pair.Key;
+		Usage.Clicks = Pair.Value.Clicks;
+		Usage.LastUsed = FDateTime(Pair.Value.LastUsedTicks);
+	}
+}
+
+void FDocumentationLinkUsage::Reset()
+{
+	DrainPending();
+
+	for (TPair<FString, FCounter>& Pair : Counters)
+	{
+		Pair.Value = FCounter();
+	}
+	bDirty = true;
+}
+
+int32 FDocumentationLinkUsage::GetNumCounters() const
+{
+	return Counters.Num();
+}
+
+SIZE_T FDocumentationLinkUsage::GetAllocatedSize() const
+{
+	SIZE_T Size = Counters.GetAllocatedSize();
+	for (const TPair<FString, FCounter>& Pair : Counters)
+	{
+		Size += Pair.Key.GetAllocatedSize();
+	}
+	return Size;
+}
+
+FString FDocumentationLinkUsage::GetFilePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("DocumentationUtilities") / TEXT("LinkUsage.bin");
+}
+
+void FDocumentationLinkUsage::Load()
+{
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *GetFilePath(), FILEREAD_Silent))
+	{
+		return;
+	}
+
+	FMemoryReader Reader(Bytes);
+
+	int32 Version = 0;
+	Reader << Version;
+	if (Version != DocumentationLinkUsage::FileVersion)
+	{
+		return;
+	}
+
+	TMap<FString, TPair<uint32, int64>> Saved;
+	Reader << Saved;
+	if (Reader.IsError())
+	{
+		return;
+	}
+
+	for (const TPair<FString, TPair<uint32, int64>>& Pair : Saved)
+	{
+		FCounter& Counter = Counters.FindOrAdd(Pair.Key);
+		Counter.Clicks += Pair.Value.Key;
+		Counter.LastUsedTicks = FMath::Max(Counter.LastUsedTicks, Pair.Value.Value);
+	}
+}
+
+bool FDocumentationLinkUsage::Tick(float DeltaTime)
+{
+	Flush(false);
+	return true;
+}
+
+void FDocumentationLinkUsage::Flush(bool bWait)
+{
+	if (WriteTask.IsValid())
+	{
+		if (!bWait && !WriteTask.IsReady())
+		{
+			// Previous batch is still being written, next tick will pick up the changes
+			return;
+		}
+		WriteTask.Wait();
+		WriteTask.Reset();
+	}
+
+	DrainPending();
+	if (!bDirty)
+	{
+		return;
+	}
+	bDirty = false;
+
+	TMap<FString, TPair<uint32, int64>> Saved;
+	Saved.Reserve(Counters.Num());
+	for (const TPair<FString, FCounter>& Pair : Counters)
+	{
+		if (Pair.Value.Clicks > 0)
+		{
+			Saved.Add(Pair.Key, MakeTuple(Pair.Value.Clicks, Pair.Value.LastUsedTicks));
+		}
+	}
+
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+
+	int32 Version = DocumentationLinkUsage::FileVersion;
+	Writer << Version;
+	Writer << Saved;
+
+	WriteTask = Async(EAsyncExecution::ThreadPool, [Bytes = MoveTemp(Bytes)]()
+	{
+		FFileHelper::SaveArrayToFile(Bytes, *GetFilePath());
+	});
+
+	if (bWait)
+	{
+		WriteTask.Wait();
+		WriteTask.Reset();
+	}
+}
@@ -0,0 +1,79 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+
+/**
+ * Local statistics of opened links: click count and last use time per link key
+ *
+ * Counters are owned by game thread and updated without locks, clicks from other threads
+ * go through lock-free queue that game thread drains on timer and before reading
+ * Counters are flushed to Saved/DocumentationUtilities/LinkUsage.bin on timer when changed
+ */
+class FDocumentationLinkUsage
+{
+public:
+	struct FUsage
+	{
+		FString LinkKey;
+		uint32 Clicks = 0;
+		FDateTime LastUsed;
+	};
+
+	static FDocumentationLinkUsage& Get();
+
+	void Initialize();
+
+	/** Flush pending changes and stop timer */
+	void Shutdown();
+
+	/** Thread safe, never locks */
+	void RecordClick(const FString& LinkKey);
+
+	/** Copy of all counters. Game thread only */
+	void GetUsage(TArray<FUsage>& OutUsage);
+
+	void Reset();
+
+	/** Number and heap memory of counters */
+	int32 GetNumCounters() const;
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	struct FCounter
+	{
+		uint32 Clicks = 0;
+		int64 LastUsedTicks = 0;
+	};
+
+	struct FPendingClick
+	{
+		FString LinkKey;
+		int64 Ticks = 0;
+	};
+
+	static FString GetFilePath();
+	void Load();
+	bool Tick(float DeltaTime);
+
+	void AddClick(const FString& LinkKey, int64 Ticks);
+
+	/** Move clicks recorded off game thread into counters */
+	void DrainPending();
+
+	/** Serialize on game thread, write on worker */
+	void Flush(bool bWait);
+
+	/** Game thread only */
+	TMap<FString, FCounter> Counters;
+	bool bDirty = false;
+
+	TQueue<FPendingClick, EQueueMode::Mpsc> PendingClicks;
+
+	TFuture<void> WriteTask;
+	FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -0,0 +1,41 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "DocumentationLinksLibrary.h"
+#include "DocumentationUtilitiesSettings.h"
+
+
+
+int32 UDocumentationLinksLibrary::SetLinks(const TMap<FString, FString>& Links, bool bSaveConfig)
+{
+	return EditLinks(Links, TArray<FString>(), bSaveConfig);
+}
+
+int32 UDocumentationLinksLibrary::RemoveLinks(const TArray<FString>& Keys, bool bSaveConfig)
+{
+	return EditLinks(TMap<FString, FString>(), Keys, bSaveConfig);
+}
+
+int32 UDocumentationLinksLibrary::EditLinks(const TMap<FString, FString>& LinksToSet, const TArray<FString>& LinksToRemove, bool bSaveConfig)
+{
+	UDocumentationUtilities* Settings = GetMutableDefault<UDocumentationUtilities>();
+	return Settings ? Settings->EditLinks(LinksToSet, LinksToRemove, bSaveConfig) : 0;
+}
+
+TMap<FString, FString> UDocumentationLinksLibrary::GetLinks()
+{
+	TMap<FString, FString> Result;
+	if (const UDocumentationUtilities* Settings = GetDefault<UDocumentationUtilities>())
+	{
+		Result.Reserve(Settings->Links.Num());
+		for (const FDocumentationHintLink& Link : Settings->Links)
+		{
+			Result.Add(Link.GetLinkKey(), Link.Value);
+		}
+	}
+	return Result;
+}
+
+FString UDocumentationLinksLibrary::ResolveLink(const FString& Key)
+{
+	return UDocumentationUtilities::ResolveLink(Key);
+}
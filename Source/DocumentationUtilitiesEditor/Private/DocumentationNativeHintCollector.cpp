@@ -0,0 +1,152 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "DocumentationNativeHintCollector.h"
+#include "DocumentationUtilitiesSettings.h"
+#include "DocumentationHintUtils.h"
+#include "DocumentationUtilitiesMemory.h"
+#include "HintStruct.h"
+#include "DocumentationNativeLinks.h"
+
+#include <UObject/UObjectIterator.h>
+#include <Misc/PackageName.h>
+
+
+
+namespace DocumentationNativeHintCollector
+{
+	/** Seconds per frame spent on collection */
+	static constexpr double FrameBudget = 0.002;
+}
+
+
+FDocumentationNativeHintCollector& FDocumentationNativeHintCollector::Get()
+{
+	static FDocumentationNativeHintCollector Instance;
+	return Instance;
+}
+
+void FDocumentationNativeHintCollector::Start()
+{
+	check(IsInGameThread());
+
+	if (bIsStarted)
+	{
+		return;
+	}
+	bIsStarted = true;
+
+	if (!GetDefault<UDocumentationUtilities>()->bCollectNativeHints)
+	{
+		bIsComplete = true;
+		return;
+	}
+
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+
+	// Modules that declare all links with DOCUMENTATION_NATIVE_LINK are not scanned
+	TSet<FName> SkippedPackages;
+	FDocumentationNativeLinkModule::ForEach([&SkippedPackages](const FDocumentationNativeLinkModule& Module)
+	{
+		SkippedPackages.Add(FPackageName::GetModuleScriptPackageName(Module.ModuleName));
+	});
+
+	// Listing types is cheap, creating defaults and walking properties is what gets sliced
+	for (TObjectIterator<UClass> ClassIt; ClassIt; ++ClassIt)
+	{
+		if (!SkippedPackages.Contains(ClassIt->GetOutermost()->GetFName()))
+		{
+			PendingTypes.Add(*ClassIt);
+		}
+	}
+	for (TObjectIterator<UScriptStruct> StructIt; StructIt; ++StructIt)
+	{
+		if (!SkippedPackages.Contains(StructIt->GetOutermost()->GetFName()))
+		{
+			PendingTypes.Add(*StructIt);
+		}
+	}
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FDocumentationNativeHintCollector::Tick));
+}
+
+void FDocumentationNativeHintCollector::Finish()
+{
+	check(IsInGameThread());
+
+	if (bIsComplete)
+	{
+		return;
+	}
+
+	Start();
+	if (!bIsComplete)
+	{
+		ProcessTypes(TNumericLimits<double>::Max());
+		Apply();
+	}
+}
+
+void FDocumentationNativeHintCollector::Shutdown()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+
+	PendingTypes.Empty();
+	LinkKeys.Empty();
+}
+
+bool FDocumentationNativeHintCollector::Tick(float DeltaTime)
+{
+	if (!ProcessTypes(DocumentationNativeHintCollector::FrameBudget))
+	{
+		return true;
+	}
+
+	TickerHandle.Reset();
+	Apply();
+	return false;
+}
+
+bool FDocumentationNativeHintCollector::ProcessTypes(double TimeBudget)
+{
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+
+	const double EndTime = FPlatformTime::Seconds() + TimeBudget;
+	while (NextType < PendingTypes.Num())
+	{
+		// Type may be gone after hot reload or blueprint recompile
+		if (const UStruct* Type = PendingTypes[NextType++].Get())
+		{
+			DocumentationHintUtils::ForEachDefaultHint(Type, [this](const FStructProperty* Property, const FHintStruct& Hint)
+			{
+				FString LinkKey = Hint.GetLink();
+				if (!LinkKey.IsEmpty())
+				{
+					LinkKeys.Add(MoveTemp(LinkKey));
+				}
+			});
+		}
+
+		if ((NextType & 63) == 0 && FPlatformTime::Seconds() > EndTime)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FDocumentationNativeHintCollector::Apply()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	bIsComplete = true;
+
+	GetMutableDefault<UDocumentationUtilities>()->SetNativeLinkKeys(LinkKeys);
+
+	PendingTypes.Empty();
+	LinkKeys.Empty();
+}
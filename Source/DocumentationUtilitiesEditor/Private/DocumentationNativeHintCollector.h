@@ -0,0 +1,47 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+/**
+ * Fills NativeLinks from FHintStruct defaults of classes and structs
+ * Types of modules declared with DOCUMENTATION_NATIVE_LINKS_SKIP_SCAN are skipped
+ *
+ * Started after engine init and spread over frames with small time budget, so editor boot does not wait for it
+ * Until it finishes, NativeLinks keep values loaded from config
+ * Game thread only
+ */
+class FDocumentationNativeHintCollector
+{
+public:
+	static FDocumentationNativeHintCollector& Get();
+
+	/** Take list of types currently in memory and start processing them on ticker */
+	void Start();
+
+	/** Process all remaining types now. Starts collection if it was not started yet */
+	void Finish();
+
+	/** Drop pending work without applying it */
+	void Shutdown();
+
+	bool IsComplete() const { return bIsComplete; }
+
+private:
+	bool Tick(float DeltaTime);
+
+	/** Returns true when all types are processed */
+	bool ProcessTypes(double TimeBudget);
+	void Apply();
+
+	TArray<TWeakObjectPtr<const UStruct>> PendingTypes;
+	int32 NextType = 0;
+	TSet<FString> LinkKeys;
+
+	bool bIsStarted = false;
+	bool bIsComplete = false;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -0,0 +1,351 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "DocumentationPreviewCache.h"
+#include "DocumentationUtilitiesSettings.h"
+#include "DocumentationUtilitiesMemory.h"
+
+#include <Async/Async.h>
+#include <HAL/FileManager.h>
+#include <Misc/Paths.h>
+
+
+
+namespace DocumentationPreviewCache
+{
+	/** Memory budget for cached previews */
+	static constexpr SIZE_T MaxBytes = 2 * 1024 * 1024;
+
+	/** Count limit of the container, byte budget is reached first */
+	static constexpr int32 MaxEntries = 16384;
+
+	/** Only beginning of page is read, title and first paragraph are there */
+	static constexpr int64 MaxReadBytes = 64 * 1024;
+
+	static constexpr int32 MaxSummaryLength = 400;
+
+	static const TCHAR* Extensions[] = { TEXT(".md"), TEXT(".html"), TEXT(".htm") };
+
+	static SIZE_T GetEntrySize(const FString& Address, const FDocumentationPreview& Preview)
+	{
+		return Address.GetAllocatedSize() + Preview.GetAllocatedSize();
+	}
+
+	static FString StripHtml(FStringView Html)
+	{
+		FString Result;
+		Result.Reserve(Html.Len());
+
+		bool bInTag = false;
+		for (TCHAR Char : Html)
+		{
+			if (Char == TEXT('<'))
+			{
+				bInTag = true;
+			}
+			else if (Char == TEXT('>'))
+			{
+				bInTag = false;
+			}
+			else if (!bInTag)
+			{
+				Result.AppendChar(FChar::IsWhitespace(Char) ? TEXT(' ') : Char);
+			}
+		}
+
+		Result.ReplaceInline(TEXT("&nbsp;"), TEXT(" "));
+		Result.ReplaceInline(TEXT("&lt;"), TEXT("<"));
+		Result.ReplaceInline(TEXT("&gt;"), TEXT(">"));
+		Result.ReplaceInline(TEXT("&quot;"), TEXT("\""));
+		Result.ReplaceInline(TEXT("&#39;"), TEXT("'"));
+		Result.ReplaceInline(TEXT("&amp;"), TEXT("&"));
+		return Result.TrimStartAndEnd();
+	}
+
+	/** Inner text of first element with tag, empty if not found */
+	static FString FindHtmlElement(const FString& Html, const TCHAR* Tag)
+	{
+		const FString Open = FString::Printf(TEXT("<%s"), Tag);
+		const FString Close = FString::Printf(TEXT("</%s>"), Tag);
+
+		int32 Start = 0;
+		while ((Start = Html.Find(Open, ESearchCase::IgnoreCase, ESearchDir::FromStart, Start)) != INDEX_NONE)
+		{
+			// Skip <pre> when looking for <p>
+			const TCHAR Next = Start + Open.Len() < Html.Len() ? Html[Start + Open.Len()] : TEXT('\0');
+			if (Next == TEXT('>') || FChar::IsWhitespace(Next))
+			{
+				break;
+			}
+			Start += Open.Len();
+		}
+
+		if (Start == INDEX_NONE)
+		{
+			return FString();
+		}
+
+		const int32 ContentStart = Html.Find(TEXT(">"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Start);
+		const int32 ContentEnd = ContentStart != INDEX_NONE ? Html.Find(Close, ESearchCase::IgnoreCase, ESearchDir::FromStart, ContentStart) : INDEX_NONE;
+		if (ContentEnd == INDEX_NONE)
+		{
+			return FString();
+		}
+		return StripHtml(FStringView(Html).Mid(ContentStart + 1, ContentEnd - ContentStart - 1));
+	}
+
+	static FString TrimSummary(FString Summary)
+	{
+		if (Summary.Len() > MaxSummaryLength)
+		{
+			Summary.LeftInline(MaxSummaryLength);
+			Summary.TrimEndInline();
+			Summary.Append(TEXT("..."));
+		}
+		return Summary;
+	}
+}
+
+
+FDocumentationPreviewCache& FDocumentationPreviewCache::Get()
+{
+	static FDocumentationPreviewCache Instance;
+	return Instance;
+}
+
+FDocumentationPreviewCache::FDocumentationPreviewCache()
+	: Cache(DocumentationPreviewCache::MaxEntries)
+{
+}
+
+TSharedPtr<const FDocumentationPreview> FDocumentationPreviewCache::Request(const FString& Address)
+{
+	check(IsInGameThread());
+
+	if (Address.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	if (const FEntry* Found = Cache.FindAndTouch(Address))
+	{
+		return Found->Preview;
+	}
+
+	const FString Directory = GetDefault<UDocumentationUtilities>()->DocsPreviewDirectory.Path;
+	if (Directory.IsEmpty() || Pending.Contains(Address))
+	{
+		return nullptr;
+	}
+
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+
+	Pending.Add(Address);
+	Async(EAsyncExecution::ThreadPool, [Directory = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), Directory), Address, RequestGeneration = Generation]()
+	{
+		FDocumentationPreview Preview = LoadPreview(Directory, Address);
+		AsyncTask(ENamedThreads::GameThread, [Address, RequestGeneration, Preview = MoveTemp(Preview)]() mutable
+		{
+			FDocumentationPreviewCache& PreviewCache = FDocumentationPreviewCache::Get();
+			if (RequestGeneration == PreviewCache.Generation)
+			{
+				PreviewCache.Pending.Remove(Address);
+				PreviewCache.Add(Address, MoveTemp(Preview));
+			}
+		});
+	});
+	return nullptr;
+}
+
+void FDocumentationPreviewCache::Reset()
+{
+	Generation++;
+	Cache.Empty(DocumentationPreviewCache::MaxEntries);
+	CachedBytes = 0;
+	Pending.Empty();
+}
+
+void FDocumentationPreviewCache::Add(const FString& Address, FDocumentationPreview&& Preview)
+{
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+
+	FEntry Entry;
+	Entry.Size = DocumentationPreviewCache::GetEntrySize(Address, Preview);
+	Entry.Preview = MakeShared<const FDocumentationPreview>(MoveTemp(Preview));
+
+	while (Cache.Num() > 0 && (CachedBytes + Entry.Size > DocumentationPreviewCache::MaxBytes || Cache.Num() >= Cache.Max()))
+	{
+		const FEntry Evicted = Cache.RemoveLeastRecent();
+		CachedBytes -= FMath::Min(CachedBytes, Evicted.Size);
+	}
+
+	CachedBytes += Entry.Size;
+	Cache.Add(Address, MoveTemp(Entry));
+}
+
+FString FDocumentationPreviewCache::FindPageFile(const FString& Directory, const FString& Address)
+{
+	// Path part of URL, without host, query and fragment
+	FString PagePath = Address;
+	int32 SchemeEnd = PagePath.Find(TEXT("://"));
+	if (SchemeEnd != INDEX_NONE)
+	{
+		const int32 PathStart = PagePath.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, SchemeEnd + 3);
+		PagePath = PathStart != INDEX_NONE ? PagePath.Mid(PathStart) : FString();
+	}
+
+	int32 EndIndex = INDEX_NONE;
+	if (PagePath.FindChar(TEXT('#'), EndIndex) || PagePath.FindChar(TEXT('?'), EndIndex))
+	{
+		PagePath.LeftInline(EndIndex);
+	}
+	PagePath = FPaths::GetBaseFilename(PagePath, false);
+	PagePath.TrimCharInline(TEXT('/'), nullptr);
+
+	if (PagePath.Contains(TEXT("..")))
+	{
+		return FString();
+	}
+
+	IFileManager& FileManager = IFileManager::Get();
+	for (const TCHAR* Extension : DocumentationPreviewCache::Extensions)
+	{
+		const FString File = PagePath.IsEmpty() ? FString() : Directory / PagePath + Extension;
+		if (!File.IsEmpty() && FileManager.FileExists(*File))
+		{
+			return File;
+		}
+
+		const FString IndexFile = Directory / PagePath / TEXT("index") + Extension;
+		if (FileManager.FileExists(*IndexFile))
+		{
+			return IndexFile;
+		}
+	}
+	return FString();
+}
+
+FDocumentationPreview FDocumentationPreviewCache::LoadPreview(const FString& Directory, const FString& Address)
+{
+	const FString File = FindPageFile(Directory, Address);
+	if (File.IsEmpty())
+	{
+		return FDocumentationPreview();
+	}
+
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*File, FILEREAD_Silent));
+	if (!Reader.IsValid())
+	{
+		return FDocumentationPreview();
+	}
+
+	TArray<uint8> Bytes;
+	Bytes.SetNumUninitialized(FMath::Min(Reader->TotalSize(), DocumentationPreviewCache::MaxReadBytes));
+	Reader->Serialize(Bytes.GetData(), Bytes.Num());
+
+	FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Bytes.Num());
+	const FString Text(Converted.Length(), Converted.Get());
+
+	const FString Extension = FPaths::GetExtension(File);
+	return ParsePage(Text, Extension.StartsWith(TEXT("htm")));
+}
+
+FDocumentationPreview FDocumentationPreviewCache::ParsePage(const FString& Text, bool bIsHtml)
+{
+	FDocumentationPreview Preview;
+
+	if (bIsHtml)
+	{
+		Preview.Title = DocumentationPreviewCache::FindHtmlElement(Text, TEXT("h1"));
+		if (Preview.Title.IsEmpty())
+		{
+			Preview.Title = DocumentationPreviewCache::FindHtmlElement(Text, TEXT("title"));
+		}
+		Preview.Summary = DocumentationPreviewCache::TrimSummary(DocumentationPreviewCache::FindHtmlElement(Text, TEXT("p")));
+		return Preview;
+	}
+
+	// Markdown: first heading and first paragraph of plain lines
+	TArray<FString> Lines;
+	Text.ParseIntoArrayLines(Lines, false);
+
+	// YAML front matter: everything from opening --- on first non-empty line up to closing ---
+	int32 FirstLine = 0;
+	while (FirstLine < Lines.Num() && Lines[FirstLine].TrimStartAndEnd().IsEmpty())
+	{
+		FirstLine++;
+	}
+	if (FirstLine < Lines.Num() && Lines[FirstLine].TrimStartAndEnd() == TEXT("---"))
+	{
+		for (int32 Index = FirstLine + 1; Index < Lines.Num(); Index++)
+		{
+			if (Lines[Index].TrimStartAndEnd() == TEXT("---"))
+			{
+				FirstLine = Index + 1;
+				break;
+			}
+		}
+	}
+
+	FString Summary;
+	bool bInCode = false;
+	for (int32 LineIndex = FirstLine; LineIndex < Lines.Num(); LineIndex++)
+	{
+		const FString Line = Lines[LineIndex].TrimStartAndEnd();
+		if (Line.StartsWith(TEXT("```")))
+		{
+			bInCode = !bInCode;
+			continue;
+		}
+		if (bInCode)
+		{
+			continue;
+		}
+
+		if (Line.StartsWith(TEXT("#")))
+		{
+			if (Preview.Title.IsEmpty())
+			{
+				int32 Start = 0;
+				while (Start < Line.Len() && Line[Start] == TEXT('#'))
+				{
+					Start++;
+				}
+				Preview.Title = Line.Mid(Start).TrimStart();
+			}
+			if (!Summary.IsEmpty())
+			{
+				break;
+			}
+			continue;
+		}
+
+		if (Line.IsEmpty())
+		{
+			if (!Summary.IsEmpty())
+			{
+				break;
+			}
+			continue;
+		}
+
+		// Skip rules, images and html blocks before the first paragraph
+		if (Summary.IsEmpty() && (Line.StartsWith(TEXT("---")) || Line.StartsWith(TEXT("!")) || Line.StartsWith(TEXT("<"))))
+		{
+			continue;
+		}
+
+		if (!Summary.IsEmpty())
+		{
+			Summary.AppendChar(TEXT(' '));
+		}
+		Summary.Append(Line);
+
+		if (Summary.Len() > DocumentationPreviewCache::MaxSummaryLength)
+		{
+			break;
+		}
+	}
+
+	Preview.Summary = DocumentationPreviewCache::TrimSummary(MoveTemp(Summary));
+	return Preview;
+}
@@ -0,0 +1,67 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/LruCache.h"
+
+/** Title and first paragraph of documentation page */
+struct FDocumentationPreview
+{
+	FString Title;
+	FString Summary;
+
+	bool IsEmpty() const { return Title.IsEmpty() && Summary.IsEmpty(); }
+	SIZE_T GetAllocatedSize() const { return sizeof(*this) + Title.GetAllocatedSize() + Summary.GetAllocatedSize(); }
+};
+
+/**
+ * Previews of link addresses read from 'Docs Preview Directory' in settings
+ *
+ * URL path is mapped to file in directory: https://site/guide/actors -> guide/actors.md, .html or guide/actors/index.*
+ * Files are read and parsed on worker thread, results are kept in LRU cache capped by memory
+ * Pages without local file are cached as empty previews, so hover does not hit disk again
+ * Game thread only
+ */
+class FDocumentationPreviewCache
+{
+public:
+	static FDocumentationPreviewCache& Get();
+
+	/** Cached preview or nullptr. Starts loading when not cached */
+	TSharedPtr<const FDocumentationPreview> Request(const FString& Address);
+
+	bool IsPending(const FString& Address) const { return Pending.Contains(Address); }
+
+	/** Drop all previews, for example when directory changes */
+	void Reset();
+
+	int32 Num() const { return Cache.Num(); }
+	SIZE_T GetAllocatedSize() const { return CachedBytes; }
+
+	/** Parse Markdown or HTML page text */
+	static FDocumentationPreview ParsePage(const FString& Text, bool bIsHtml);
+
+private:
+	FDocumentationPreviewCache();
+
+	void Add(const FString& Address, FDocumentationPreview&& Preview);
+
+	static FString FindPageFile(const FString& Directory, const FString& Address);
+	static FDocumentationPreview LoadPreview(const FString& Directory, const FString& Address);
+
+	struct FEntry
+	{
+		TSharedPtr<const FDocumentationPreview> Preview;
+		/** Preview and key, subtracted from CachedBytes on eviction */
+		SIZE_T Size = 0;
+	};
+
+	TLruCache<FString, FEntry> Cache;
+	SIZE_T CachedBytes = 0;
+
+	TSet<FString> Pending;
+
+	/** Results of loads started before Reset are dropped */
+	uint32 Generation = 0;
+};
@@ -0,0 +1,413 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "DocumentationSourceIndex.h"
+#include "DocumentationUtilitiesSettings.h"
+#include "DocumentationUtilitiesMemory.h"
+
+#include <SourceCodeNavigation.h>
+#include <Async/Async.h>
+#include <Containers/Ticker.h>
+#include <HAL/FileManager.h>
+#include <Misc/FileHelper.h>
+#include <Misc/PackageName.h>
+#include <Misc/Paths.h>
+#include <Serialization/MemoryReader.h>
+#include <Serialization/MemoryWriter.h>
+#include <UObject/UObjectIterator.h>
+
+
+
+namespace DocumentationSourceIndex
+{
+	/** Bumped when header scanning changes, cached lines are scanned again */
+	static constexpr int32 CacheVersion = 2;
+
+	static bool IsIdentifierChar(TCHAR Char)
+	{
+		return FChar::IsAlnum(Char) || Char == TEXT('_');
+	}
+
+	/** Index after balanced group that starts with Open at Start, string literals are skipped whole */
+	static int32 SkipGroup(FStringView Text, int32 Start, TCHAR Open, TCHAR Close)
+	{
+		int32 Depth = 0;
+		for (int32 Index = Start; Index < Text.Len(); Index++)
+		{
+			const TCHAR Char = Text[Index];
+			if (Char == TEXT('"') || Char == TEXT('\''))
+			{
+				for (Index++; Index < Text.Len() && Text[Index] != Char; Index++)
+				{
+					if (Text[Index] == TEXT('\\'))
+					{
+						Index++;
+					}
+				}
+			}
+			else if (Char == Open)
+			{
+				Depth++;
+			}
+			else if (Char == Close && --Depth == 0)
+			{
+				return Index + 1;
+			}
+		}
+		return Text.Len();
+	}
+
+	/**
+	 * Name declared after class or struct keyword
+	 * Export macros, attributes and macros with arguments like UE_DEPRECATED(5.1, "...") are skipped
+	 */
+	static FStringView FindDeclaredName(FStringView Declaration)
+	{
+		int32 Index = 0;
+		while (Index < Declaration.Len())
+		{
+			const TCHAR Char = Declaration[Index];
+			if (FChar::IsWhitespace(Char))
+			{
+				Index++;
+			}
+			else if (Char == TEXT('['))
+			{
+				Index = SkipGroup(Declaration, Index, TEXT('['), TEXT(']'));
+			}
+			else if (IsIdentifierChar(Char))
+			{
+				const int32 NameStart = Index;
+				while (Index < Declaration.Len() && IsIdentifierChar(Declaration[Index]))
+				{
+					Index++;
+				}
+				const FStringView Name = Declaration.Mid(NameStart, Index - NameStart);
+
+				int32 Next = Index;
+				while (Next < Declaration.Len() && FChar::IsWhitespace(Declaration[Next]))
+				{
+					Next++;
+				}
+
+				if (Next < Declaration.Len() && Declaration[Next] == TEXT('('))
+				{
+					Index = SkipGroup(Declaration, Next, TEXT('('), TEXT(')'));
+				}
+				else if (!Name.EndsWith(TEXT("_API")))
+				{
+					return Name;
+				}
+			}
+			else
+			{
+				// Base list, body or anything else ends the declaration
+				break;
+			}
+		}
+		return FStringView();
+	}
+}
+
+const FName FDocumentationSourceIndex::Scheme = TEXT("source");
+
+
+FDocumentationSourceIndex& FDocumentationSourceIndex::Get()
+{
+	static FDocumentationSourceIndex Instance;
+	return Instance;
+}
+
+void FDocumentationSourceIndex::Initialize()
+{
+	if (!GetDefault<UDocumentationUtilities>()->bIndexSourceFiles || !FSourceCodeNavigation::IsCompilerAvailable())
+	{
+		return;
+	}
+
+	ReloadHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason)
+	{
+		RequestUpdate();
+	});
+
+	RequestUpdate();
+}
+
+void FDocumentationSourceIndex::Shutdown()
+{
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadHandle);
+	ReloadHandle.Reset();
+
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+
+	if (BuildTask.IsValid())
+	{
+		BuildTask.Wait();
+		BuildTask.Reset();
+	}
+	bUpdatePending = false;
+}
+
+void FDocumentationSourceIndex::RequestUpdate()
+{
+	check(IsInGameThread());
+
+	if (BuildTask.IsValid())
+	{
+		bUpdatePending = true;
+		return;
+	}
+	bUpdatePending = false;
+
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+	BuildTask = Async(EAsyncExecution::ThreadPool, [Types = CollectTypes(), Previous = Data]() mutable
+	{
+		LLM_SCOPE_BYTAG(DocumentationUtilities);
+		return BuildIndex(MoveTemp(Types), Previous);
+	});
+
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FDocumentationSourceIndex::Tick));
+	}
+}
+
+bool FDocumentationSourceIndex::Tick(float DeltaTime)
+{
+	if (!BuildTask.IsValid() || !BuildTask.IsReady())
+	{
+		return true;
+	}
+
+	Data = BuildTask.Get();
+	BuildTask.Reset();
+
+	if (bUpdatePending)
+	{
+		RequestUpdate();
+		return true;
+	}
+
+	TickerHandle.Reset();
+	return false;
+}
+
+SIZE_T FDocumentationSourceIndex::GetAllocatedSize() const
+{
+	if (!Data.IsValid())
+	{
+		return 0;
+	}
+
+	SIZE_T Size = sizeof(FIndexData) + Data->Types.GetAllocatedSize() + Data->Headers.GetAllocatedSize();
+	for (const auto& Pair : Data->Types)
+	{
+		Size += Pair.Key.GetAllocatedSize() + Pair.Value.Key.GetAllocatedSize() + Pair.Value.Value.GetAllocatedSize();
+	}
+	for (const auto& Pair : Data->Headers)
+	{
+		Size += Pair.Key.GetAllocatedSize() + Pair.Value.Lines.GetAllocatedSize();
+		for (const TPair<FString, int32>& Line : Pair.Value.Lines)
+		{
+			Size += Line.Key.GetAllocatedSize();
+		}
+	}
+	return Size;
+}
+
+bool FDocumentationSourceIndex::FindSource(const FString& TypePath, FString& OutHeaderPath, int32& OutLine) const
+{
+	check(IsInGameThread());
+
+	OutLine = 0;
+	if (Data.IsValid())
+	{
+		if (const TPair<FString, FString>* Type = Data->Types.Find(TypePath))
+		{
+			OutHeaderPath = Type->Key;
+			if (const FHeaderInfo* Header = Data->Headers.Find(Type->Key))
+			{
+				const int32* Line = Header->Lines.Find(Type->Value);
+				OutLine = Line ? *Line : 0;
+			}
+			return true;
+		}
+	}
+
+	const UStruct* Type = FindObject<UStruct>(nullptr, *TypePath);
+	return Type && FSourceCodeNavigation::FindClassHeaderPath(Type, OutHeaderPath);
+}
+
+void FDocumentationSourceIndex::OpenSource(const FString& TypePath)
+{
+	FString HeaderPath;
+	int32 Line = 0;
+	if (Get().FindSource(TypePath, HeaderPath, Line))
+	{
+		FSourceCodeNavigation::OpenSourceFile(HeaderPath, FMath::Max(Line, 1), 0);
+	}
+}
+
+FString FDocumentationSourceIndex::MakeLink(const UStruct* Type)
+{
+	return Type ? FString::Printf(TEXT("%s:%s"), *Scheme.ToString(), *Type->GetPathName()) : FString();
+}
+
+TArray<FDocumentationSourceIndex::FTypeInfo> FDocumentationSourceIndex::CollectTypes()
+{
+	check(IsInGameThread());
+
+	TMap<FString, FString> ModulePaths;
+	TArray<FTypeInfo> Types;
+
+	auto AddType = [&ModulePaths, &Types](const UStruct* Type)
+	{
+		const FString& RelativePath = Type->GetMetaData(TEXT("ModuleRelativePath"));
+		if (RelativePath.IsEmpty())
+		{
+			return;
+		}
+
+		const FString ModuleName = FPackageName::GetShortName(Type->GetOutermost()->GetName());
+
+		FString* ModulePath = ModulePaths.Find(ModuleName);
+		if (ModulePath == nullptr)
+		{
+			ModulePath = &ModulePaths.Add(ModuleName);
+			FSourceCodeNavigation::FindModulePath(ModuleName, *ModulePath);
+		}
+
+		if (!ModulePath->IsEmpty())
+		{
+			FTypeInfo& Info = Types.AddDefaulted_GetRef();
+			Info.TypePath = Type->GetPathName();
+			Info.CppName = FString(Type->GetPrefixCPP()) + Type->GetName();
+			Info.HeaderPath = *ModulePath / RelativePath;
+		}
+	};
+
+	for (TObjectIterator<UClass> ClassIt; ClassIt; ++ClassIt)
+	{
+		if (ClassIt->HasAnyClassFlags(CLASS_Native))
+		{
+			AddType(*ClassIt);
+		}
+	}
+
+	for (TObjectIterator<UScriptStruct> StructIt; StructIt; ++StructIt)
+	{
+		if (StructIt->StructFlags & STRUCT_Native)
+		{
+			AddType(*StructIt);
+		}
+	}
+
+	return Types;
+}
+
+FDocumentationSourceIndex::FIndexDataPtr FDocumentationSourceIndex::BuildIndex(TArray<FTypeInfo> Types, FIndexDataPtr Previous)
+{
+	if (!Previous.IsValid())
+	{
+		Previous = LoadCache();
+	}
+
+	TSharedRef<FIndexData, ESPMode::ThreadSafe> Index = MakeShared<FIndexData, ESPMode::ThreadSafe>();
+	Index->Types.Reserve(Types.Num());
+
+	bool bChanged = !Previous.IsValid();
+	for (const FTypeInfo& Type : Types)
+	{
+		Index->Types.Add(Type.TypePath, TPair<FString, FString>(Type.HeaderPath, Type.CppName));
+
+		if (Index->Headers.Contains(Type.HeaderPath))
+		{
+			continue;
+		}
+
+		const FDateTime Timestamp = IFileManager::Get().GetTimeStamp(*Type.HeaderPath);
+		const FHeaderInfo* PreviousHeader = Previous.IsValid() ? Previous->Headers.Find(Type.HeaderPath) : nullptr;
+		if (PreviousHeader && PreviousHeader->Timestamp == Timestamp)
+		{
+			Index->Headers.Add(Type.HeaderPath, *PreviousHeader);
+			continue;
+		}
+
+		FHeaderInfo& Header = Index->Headers.Add(Type.HeaderPath);
+		Header.Timestamp = Timestamp;
+		ScanHeader(Type.HeaderPath, Header);
+		bChanged = true;
+	}
+
+	if (bChanged || Previous->Types.Num() != Index->Types.Num())
+	{
+		SaveCache(*Index);
+	}
+	return Index;
+}
+
+void FDocumentationSourceIndex::ScanHeader(const FString& HeaderPath, FHeaderInfo& OutInfo)
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *HeaderPath))
+	{
+		return;
+	}
+
+	for (int32 LineIndex = 0; LineIndex < Lines.Num(); LineIndex++)
+	{
+		FStringView Line = FStringView(Lines[LineIndex]).TrimStartAndEnd();
+		if (!(Line.StartsWith(TEXT("class ")) || Line.StartsWith(TEXT("struct "))) || Line.EndsWith(TEXT(';')))
+		{
+			continue;
+		}
+
+		// class MODULE_API UE_DEPRECATED(5.1, "Use UOther") UName : public UBase
+		int32 KeywordEnd = 0;
+		Line.FindChar(TEXT(' '), KeywordEnd);
+		const FStringView Name = DocumentationSourceIndex::FindDeclaredName(Line.RightChop(KeywordEnd));
+		if (!Name.IsEmpty())
+		{
+			OutInfo.Lines.FindOrAdd(FString(Name), LineIndex + 1);
+		}
+	}
+}
+
+FString FDocumentationSourceIndex::GetCachePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("DocumentationUtilities") / TEXT("SourceIndex.bin");
+}
+
+FDocumentationSourceIndex::FIndexDataPtr FDocumentationSourceIndex::LoadCache()
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *GetCachePath(), FILEREAD_Silent))
+	{
+		return nullptr;
+	}
+
+	FMemoryReader Reader(Bytes);
+
+	int32 Version = 0;
+	Reader << Version;
+	if (Version != DocumentationSourceIndex::CacheVersion)
+	{
+		return nullptr;
+	}
+
+	TSharedRef<FIndexData, ESPMode::ThreadSafe> Index = MakeShared<FIndexData, ESPMode::ThreadSafe>();
+	Reader << *Index;
+	return Reader.IsError() ? nullptr : FIndexDataPtr(Index);
+}
+
+void FDocumentationSourceIndex::SaveCache(const FIndexData& Index)
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+
+	int32 Version = DocumentationSourceIndex::CacheVersion;
+	Writer << Version;
+	Writer << const_cast<FIndexData&>(Index);
+
+	FFileHelper::SaveArrayToFile(Bytes, *GetCachePath());
+}
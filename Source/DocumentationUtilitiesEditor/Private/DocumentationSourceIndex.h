@@ -0,0 +1,93 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+
+/**
+ * Native type -> declaring header and line
+ * Used by 'source:' links, payload is type path: source:/Script/Engine.Actor
+ *
+ * Built on worker thread after engine init and saved to Saved/DocumentationUtilities
+ * Next sessions and hot reloads only rescan headers that changed since the last build
+ */
+class FDocumentationSourceIndex
+{
+public:
+	static FDocumentationSourceIndex& Get();
+
+	static const FName Scheme;
+
+	void Initialize();
+	void Shutdown();
+
+	/** Start incremental rebuild. Collects types on game thread, scans headers on worker */
+	void RequestUpdate();
+
+	bool IsReady() const { return Data.IsValid(); }
+
+	/** Number of types and heap memory of current index */
+	int32 GetNumTypes() const { return Data.IsValid() ? Data->Types.Num() : 0; }
+	SIZE_T GetAllocatedSize() const;
+
+	/** Game thread only. Falls back to header path without line when index is not ready */
+	bool FindSource(const FString& TypePath, FString& OutHeaderPath, int32& OutLine) const;
+
+	/** Scheme handler */
+	static void OpenSource(const FString& TypePath);
+
+	static FString MakeLink(const UStruct* Type);
+
+private:
+	struct FTypeInfo
+	{
+		FString TypePath;
+		FString CppName;
+		FString HeaderPath;
+	};
+
+	struct FHeaderInfo
+	{
+		FDateTime Timestamp;
+		/** CppName -> 1-based line */
+		TMap<FString, int32> Lines;
+
+		friend FArchive& operator<<(FArchive& Ar, FHeaderInfo& Info)
+		{
+			return Ar << Info.Timestamp << Info.Lines;
+		}
+	};
+
+	struct FIndexData
+	{
+		/** TypePath -> (HeaderPath, CppName) */
+		TMap<FString, TPair<FString, FString>> Types;
+		TMap<FString, FHeaderInfo> Headers;
+
+		friend FArchive& operator<<(FArchive& Ar, FIndexData& Index)
+		{
+			return Ar << Index.Types << Index.Headers;
+		}
+	};
+
+	using FIndexDataPtr = TSharedPtr<const FIndexData, ESPMode::ThreadSafe>;
+
+	static TArray<FTypeInfo> CollectTypes();
+	static FIndexDataPtr BuildIndex(TArray<FTypeInfo> Types, FIndexDataPtr Previous);
+	static void ScanHeader(const FString& HeaderPath, FHeaderInfo& OutInfo);
+
+	static FString GetCachePath();
+	static FIndexDataPtr LoadCache();
+	static void SaveCache(const FIndexData& Index);
+
+	bool Tick(float DeltaTime);
+
+	FIndexDataPtr Data;
+	TFuture<FIndexDataPtr> BuildTask;
+	bool bUpdatePending = false;
+
+	FDelegateHandle ReloadHandle;
+	FTSTicker::FDelegateHandle TickerHandle;
+};
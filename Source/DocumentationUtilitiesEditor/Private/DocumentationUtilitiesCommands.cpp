@@ -0,0 +1,25 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "DocumentationUtilitiesCommands.h"
+
+#include <Styling/AppStyle.h>
+
+
+
+#define LOCTEXT_NAMESPACE "DocumentationUtilities"
+
+FDocumentationUtilitiesCommands::FDocumentationUtilitiesCommands()
+	: TCommands<FDocumentationUtilitiesCommands>(
+		TEXT("DocumentationUtilities"),
+		LOCTEXT("DocumentationUtilitiesCommands", "Documentation Utilities"),
+		NAME_None,
+		FAppStyle::GetAppStyleSetName())
+{
+}
+
+void FDocumentationUtilitiesCommands::RegisterCommands()
+{
+	UI_COMMAND(OpenPalette, "Open Documentation", "Find documented class, asset or link by name and open it", EUserInterfaceActionType::Button, FInputChord(EModifierKey::Control | EModifierKey::Alt, EKeys::H));
+}
+
+#undef LOCTEXT_NAMESPACE
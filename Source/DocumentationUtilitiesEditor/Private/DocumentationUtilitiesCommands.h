@@ -0,0 +1,19 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Framework/Commands/Commands.h"
+
+class FDocumentationUtilitiesCommands : public TCommands<FDocumentationUtilitiesCommands>
+{
+public:
+	FDocumentationUtilitiesCommands();
+
+	//~ Begin TCommands Interface
+	virtual void RegisterCommands() override;
+	//~ End TCommands Interface
+
+	/** Jump to documented class, asset or link key */
+	TSharedPtr<FUICommandInfo> OpenPalette;
+};
@@ -6,8 +6,28 @@
 
 
 #include "HintStruct.h"
+#include "DocumentationUtilitiesSettings.h"
+#include "DocumentationLinkSnapshot.h"
+#include "DocumentationLinkSchemes.h"
+#include "DocumentationSourceIndex.h"
+#include "DocumentationLinkUsage.h"
+#include "DocumentationNativeHintCollector.h"
+#include "DocumentationLinkTableCooker.h"
+#include "DocumentationAssetLoader.h"
+#include "DocumentationLinkFixup.h"
+#include "DocumentationLinkGC.h"
+#include "HintTemplate.h"
+#include "DocumentationUtilitiesCommands.h"
+#include "DocumentationUtilitiesMemory.h"
 #include "Customizations/HintStructCustomization.h"
 #include "Customizations/HintLinkCustomization.h"
+#include "Customizations/DocumentationSettingsCustomization.h"
+#include "Widgets/HintMarkdown.h"
+#include "Widgets/SDocumentationSearch.h"
+#include "Widgets/SDocumentationLinkUsage.h"
+#include "Widgets/SDocumentationLinkGC.h"
+#include "Widgets/SDocumentationPalette.h"
+#include "Search/DocumentationSearchIndex.h"
 
 #include <ToolMenus.h>
 #include <ContentBrowserMenuContexts.h>
@@ -16,7 +36,20 @@
 #include <Framework/Notifications/NotificationManager.h>
 #include <Widgets/Notifications/SNotificationList.h>
 
+#include <Editor.h>
 #include <Subsystems/AssetEditorSubsystem.h>
+#include <Toolkits/AssetEditorToolkit.h>
+#include <AssetRegistry/AssetRegistryModule.h>
+#include <ContentBrowserModule.h>
+#include <Widgets/Images/SImage.h>
+#include <Widgets/Input/SButton.h>
+#include <Widgets/Text/STextBlock.h>
+#include <Widgets/Docking/SDockTab.h>
+#include <Framework/Docking/TabManager.h>
+#include <Framework/Application/SlateApplication.h>
+#include <WorkspaceMenuStructure.h>
+#include <WorkspaceMenuStructureModule.h>
+#include <LevelEditor.h>
 
 
 
@@ -24,10 +57,9 @@
 
 
 
-void IDocumentationUtilitiesEditorModule::OpenLink(FString Link)
+namespace DocumentationLinkHandlers
 {
-	FString Address = UDocumentationUtilities::ResolveLink(Link);
-	if (Address.StartsWith(TEXT("http")) || Address.StartsWith(TEXT("https")))
+	static void OpenURL(const FString& Address)
 	{
 		FText Message = LOCTEXT("OpeningURLMessage", "You are about to open an external URL. This will open your web browser. Do you want to proceed?");
 		FText URLDialog = LOCTEXT("OpeningURLTitle", "Open external link");
@@ -42,15 +74,64 @@ void IDocumentationUtilitiesEditorModule::OpenLink(FString Link)
 			FPlatformProcess::LaunchURL(*Address, nullptr, nullptr);
 		}
 	}
-	else if (Address.StartsWith(TEXT("/")) || Address.StartsWith(TEXT("Edit:/")) || Address.StartsWith(TEXT("View:/")))
+
+	static void OpenAsset(const FString& Path, EAssetTypeActivationOpenedMethod Method)
 	{
-		EAssetTypeActivationOpenedMethod Method = Address.StartsWith(TEXT("Edit:/")) ? EAssetTypeActivationOpenedMethod::Edit : EAssetTypeActivationOpenedMethod::View;
-		Address.RemoveFromStart(TEXT("Edit:"));
-		Address.RemoveFromStart(TEXT("View:"));
+		FDocumentationAssetLoader::Get().Open(Path, Method);
+	}
 
-		GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->OpenEditorForAsset(Address, Method);
-	}	
-	else
+	static void PrefetchAsset(const FString& Path)
+	{
+		FDocumentationAssetLoader::Get().Prefetch(Path);
+	}
+
+	static bool IsAssetPath(const FString& Path)
+	{
+		return Path.StartsWith(TEXT("/"));
+	}
+
+	static void Register()
+	{
+		FDocumentationLinkSchemes& Schemes = FDocumentationLinkSchemes::Get();
+
+		FDocumentationLinkScheme URLScheme(FOnOpenDocumentationLink::CreateStatic(&OpenURL), true);
+		Schemes.RegisterScheme(TEXT("http"), URLScheme);
+		Schemes.RegisterScheme(TEXT("https"), URLScheme);
+
+		FDocumentationLinkScheme EditScheme(FOnOpenDocumentationLink::CreateStatic(&OpenAsset, EAssetTypeActivationOpenedMethod::Edit));
+		EditScheme.OnValidate.BindStatic(&IsAssetPath);
+		EditScheme.OnPrefetch.BindStatic(&PrefetchAsset);
+		Schemes.RegisterScheme(TEXT("Edit"), EditScheme);
+
+		FDocumentationLinkScheme ViewScheme(FOnOpenDocumentationLink::CreateStatic(&OpenAsset, EAssetTypeActivationOpenedMethod::View));
+		ViewScheme.OnValidate.BindStatic(&IsAssetPath);
+		ViewScheme.OnPrefetch.BindStatic(&PrefetchAsset);
+		Schemes.RegisterScheme(FDocumentationLinkSchemes::PathScheme, ViewScheme);
+
+		FDocumentationLinkScheme SourceScheme(FOnOpenDocumentationLink::CreateStatic(&FDocumentationSourceIndex::OpenSource));
+		SourceScheme.OnValidate.BindStatic(&IsAssetPath);
+		Schemes.RegisterScheme(FDocumentationSourceIndex::Scheme, SourceScheme);
+	}
+
+	static void Unregister()
+	{
+		FDocumentationLinkSchemes& Schemes = FDocumentationLinkSchemes::Get();
+		Schemes.UnregisterScheme(TEXT("http"));
+		Schemes.UnregisterScheme(TEXT("https"));
+		Schemes.UnregisterScheme(TEXT("Edit"));
+		Schemes.UnregisterScheme(FDocumentationLinkSchemes::PathScheme);
+		Schemes.UnregisterScheme(FDocumentationSourceIndex::Scheme);
+	}
+}
+
+
+
+void IDocumentationUtilitiesEditorModule::OpenLink(FString Link)
+{
+	FDocumentationLinkUsage::Get().RecordClick(Link);
+
+	FString Address = UDocumentationUtilities::ResolveLink(Link);
+	if (!FDocumentationLinkSchemes::Get().Open(Address))
 	{
 		const FText ErrorText = LOCTEXT("OpenURL_BadAddress", "Failed to open link: Bad address");
 		FNotificationInfo Info(ErrorText);
@@ -59,13 +140,18 @@ void IDocumentationUtilitiesEditorModule::OpenLink(FString Link)
 	}	
 }
 
+void IDocumentationUtilitiesEditorModule::PrefetchLink(FString Link)
+{
+	if (!Link.IsEmpty())
+	{
+		FDocumentationLinkSchemes::Get().Prefetch(UDocumentationUtilities::ResolveLink(Link));
+	}
+}
+
 bool IDocumentationUtilitiesEditorModule::IsLinkValid(FString Link)
 {
 	FString Address = UDocumentationUtilities::ResolveLink(Link);
-	return !Address.IsEmpty() && (
-			Address.StartsWith(TEXT("http")) || Address.StartsWith(TEXT("https")) || 
-			Address.StartsWith(TEXT("/")) || Address.StartsWith(TEXT("Edit:/")) || Address.StartsWith(TEXT("View:/"))
-	);
+	return !Address.IsEmpty() && FDocumentationLinkSchemes::Get().Parse(Address).IsValid();
 }
 
 
@@ -75,28 +161,220 @@ class FDocumentationUtilitiesEditorModule : public IDocumentationUtilitiesEditor
 public:
 	virtual void StartupModule() override
 	{
+		LLM_SCOPE_BYTAG(DocumentationUtilities);
+
 		FPropertyEditorModule& PropertyModule = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
 		{
 			PropertyModule.RegisterCustomPropertyTypeLayout(FHintStruct::StaticStruct()->GetFName(), FOnGetPropertyTypeCustomizationInstance::CreateStatic(&FHintStructCustomization::MakeInstance));
 			PropertyModule.RegisterCustomPropertyTypeLayout(FDocumentationHintLink::StaticStruct()->GetFName(), FOnGetPropertyTypeCustomizationInstance::CreateStatic(&FHintLinkCustomization::MakeInstance));
+			PropertyModule.RegisterCustomClassLayout(UDocumentationUtilities::StaticClass()->GetFName(), FOnGetDetailCustomizationInstance::CreateStatic(&FDocumentationSettingsCustomization::MakeInstance));
 		}
 
+		DocumentationLinkHandlers::Register();
+
 		RegisterToolMenu();
+		RegisterContentBrowserBadges();
+		RegisterTabs();
+
+		// Commands need level editor and menus, which commandlets never show
+		if (!IsRunningCommandlet())
+		{
+			UToolMenus::RegisterStartupCallback(FSimpleMulticastDelegate::FDelegate::CreateRaw(this, &FDocumentationUtilitiesEditorModule::RegisterCommands));
+		}
+		FDocumentationSearchIndex::Get().RegisterAssetTags();
+		FDocumentationLinkUsage::Get().Initialize();
+		FDocumentationLinkTableCooker::Get().Initialize();
+		FDocumentationLinkFixup::Get().Initialize();
+		FHintTemplateCache::Get().Initialize();
+
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+		if (AssetRegistry.IsLoadingAssets())
+		{
+			AssetRegistry.OnFilesLoaded().AddRaw(this, &FDocumentationUtilitiesEditorModule::OnAssetRegistryFilesLoaded);
+		}
+		else
+		{
+			OnAssetRegistryFilesLoaded();
+		}
+
+		FCoreDelegates::OnPostEngineInit.AddRaw(this, &FDocumentationUtilitiesEditorModule::OnPostEngineInit);
 	}
 
 	virtual void ShutdownModule() override
 	{
 		UnregisterToolMenu();
+		UnregisterContentBrowserBadges();
+		UnregisterTabs();
+		UnregisterCommands();
+		FHintMarkdownParser::ClearCache();
+		FDocumentationLinkSnapshot::Publish(nullptr);
+
+		DocumentationLinkHandlers::Unregister();
+
+		FCoreDelegates::OnPostEngineInit.RemoveAll(this);
+		FDocumentationNativeHintCollector::Get().Shutdown();
+		FDocumentationSourceIndex::Get().Shutdown();
+		FDocumentationSearchIndex::Get().Shutdown();
+		FDocumentationLinkUsage::Get().Shutdown();
+		FDocumentationLinkTableCooker::Get().Shutdown();
+		FDocumentationAssetLoader::Get().Shutdown();
+		FDocumentationLinkFixup::Get().Shutdown();
+		FDocumentationLinkGC::Get().Shutdown();
+		FHintTemplateCache::Get().Shutdown();
+
+		if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+		{
+			AssetRegistryModule->Get().OnFilesLoaded().RemoveAll(this);
+		}
 
 		if (FModuleManager::Get().IsModuleLoaded("PropertyEditor"))
 		{
 			FPropertyEditorModule& PropertyModule = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
 			PropertyModule.UnregisterCustomPropertyTypeLayout(FHintStruct::StaticStruct()->GetFName());
 			PropertyModule.UnregisterCustomPropertyTypeLayout(FDocumentationHintLink::StaticStruct()->GetFName());
+			PropertyModule.UnregisterCustomClassLayout(UDocumentationUtilities::StaticClass()->GetFName());
 		}
 	}
 
 private:
+	void OnPostEngineInit()
+	{
+		LLM_SCOPE_BYTAG(DocumentationUtilities);
+		FDocumentationNativeHintCollector::Get().Start();
+		GetMutableDefault<UDocumentationUtilities>()->LoadLinkTables();
+		FDocumentationSourceIndex::Get().Initialize();
+	}
+
+	void OnAssetRegistryFilesLoaded()
+	{
+		LLM_SCOPE_BYTAG(DocumentationUtilities);
+		if (UDocumentationUtilities* Settings = GetMutableDefault<UDocumentationUtilities>())
+		{
+			Settings->CollectAssetHints();
+		}
+		FDocumentationSearchIndex::Get().Initialize();
+	}
+
+	void RegisterTabs()
+	{
+		FGlobalTabmanager::Get()->RegisterNomadTabSpawner(SDocumentationSearch::TabName, FOnSpawnTab::CreateLambda([](const FSpawnTabArgs& Args)
+			{
+				return SNew(SDockTab)
+					.TabRole(ETabRole::NomadTab)
+					[
+						SNew(SDocumentationSearch)
+					];
+			}))
+			.SetDisplayName(LOCTEXT("SearchDocumentationTab", "Search Documentation"))
+			.SetTooltipText(LOCTEXT("SearchDocumentationTab_Tooltip", "Search documentation hints and links"))
+			.SetGroup(WorkspaceMenu::GetMenuStructure().GetToolsCategory())
+			.SetIcon(FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Documentation"));
+
+		FGlobalTabmanager::Get()->RegisterNomadTabSpawner(SDocumentationLinkUsage::TabName, FOnSpawnTab::CreateLambda([](const FSpawnTabArgs& Args)
+			{
+				return SNew(SDockTab)
+					.TabRole(ETabRole::NomadTab)
+					[
+						SNew(SDocumentationLinkUsage)
+					];
+			}))
+			.SetDisplayName(LOCTEXT("LinkUsageTab", "Documentation Link Usage"))
+			.SetTooltipText(LOCTEXT("LinkUsageTab_Tooltip", "Most opened documentation links and links that were never opened"))
+			.SetGroup(WorkspaceMenu::GetMenuStructure().GetToolsCategory())
+			.SetIcon(FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Documentation"));
+
+		FGlobalTabmanager::Get()->RegisterNomadTabSpawner(SDocumentationLinkGC::TabName, FOnSpawnTab::CreateLambda([](const FSpawnTabArgs& Args)
+			{
+				return SNew(SDockTab)
+					.TabRole(ETabRole::NomadTab)
+					[
+						SNew(SDocumentationLinkGC)
+					];
+			}))
+			.SetDisplayName(LOCTEXT("LinkGCTab", "Documentation Link Cleanup"))
+			.SetTooltipText(LOCTEXT("LinkGCTab_Tooltip", "Links that nothing uses and hint keys without value"))
+			.SetGroup(WorkspaceMenu::GetMenuStructure().GetToolsCategory())
+			.SetIcon(FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Documentation"));
+	}
+
+	void RegisterCommands()
+	{
+		FDocumentationUtilitiesCommands::Register();
+
+		// Same list as Open Asset, so the hotkey works in level editor and its tabs
+		FLevelEditorModule& LevelEditorModule = FModuleManager::LoadModuleChecked<FLevelEditorModule>("LevelEditor");
+		LevelEditorModule.GetGlobalLevelEditorActions()->MapAction(
+			FDocumentationUtilitiesCommands::Get().OpenPalette,
+			FExecuteAction::CreateStatic(&SDocumentationPalette::Open));
+
+		// Asset editors route hotkeys through their own toolkit commands, map into each one as it opens
+		if (UAssetEditorSubsystem* AssetEditorSubsystem = GEditor ? GEditor->GetEditorSubsystem<UAssetEditorSubsystem>() : nullptr)
+		{
+			AssetEditorSubsystem->OnAssetEditorOpened().AddRaw(this, &FDocumentationUtilitiesEditorModule::OnAssetEditorOpened);
+		}
+
+		if (UToolMenu* Menu = UToolMenus::Get()->ExtendMenu("LevelEditor.MainMenu.Tools"))
+		{
+			FToolMenuSection& Section = Menu->FindOrAddSection("DocumentationUtilities");
+			Section.AddMenuEntryWithCommandList(FDocumentationUtilitiesCommands::Get().OpenPalette, LevelEditorModule.GetGlobalLevelEditorActions(),
+				TAttribute<FText>(), TAttribute<FText>(), FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Documentation"));
+		}
+	}
+
+	void OnAssetEditorOpened(UObject* Asset)
+	{
+		UAssetEditorSubsystem* AssetEditorSubsystem = GEditor ? GEditor->GetEditorSubsystem<UAssetEditorSubsystem>() : nullptr;
+		IAssetEditorInstance* EditorInstance = AssetEditorSubsystem ? AssetEditorSubsystem->FindEditorForAsset(Asset, false) : nullptr;
+		if (EditorInstance == nullptr)
+		{
+			return;
+		}
+
+		// Every asset editor instance is a toolkit, same cast as engine uses
+		const TSharedRef<FUICommandList>& ToolkitCommands = static_cast<FAssetEditorToolkit*>(EditorInstance)->GetToolkitCommands();
+		if (!ToolkitCommands->IsActionMapped(FDocumentationUtilitiesCommands::Get().OpenPalette))
+		{
+			ToolkitCommands->MapAction(FDocumentationUtilitiesCommands::Get().OpenPalette, FExecuteAction::CreateStatic(&SDocumentationPalette::Open));
+		}
+	}
+
+	void UnregisterCommands()
+	{
+		UToolMenus::UnRegisterStartupCallback(this);
+		if (!FDocumentationUtilitiesCommands::IsRegistered())
+		{
+			return;
+		}
+
+		if (UToolMenus* ToolMenus = UToolMenus::TryGet())
+		{
+			if (UToolMenu* Menu = ToolMenus->FindMenu("LevelEditor.MainMenu.Tools"))
+			{
+				Menu->RemoveSection("DocumentationUtilities");
+			}
+		}
+
+		if (FLevelEditorModule* LevelEditorModule = FModuleManager::GetModulePtr<FLevelEditorModule>("LevelEditor"))
+		{
+			LevelEditorModule->GetGlobalLevelEditorActions()->UnmapAction(FDocumentationUtilitiesCommands::Get().OpenPalette);
+		}
+		if (UAssetEditorSubsystem* AssetEditorSubsystem = GEditor ? GEditor->GetEditorSubsystem<UAssetEditorSubsystem>() : nullptr)
+		{
+			AssetEditorSubsystem->OnAssetEditorOpened().RemoveAll(this);
+		}
+		FDocumentationUtilitiesCommands::Unregister();
+	}
+
+	void UnregisterTabs()
+	{
+		if (FSlateApplication::IsInitialized())
+		{
+			FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(SDocumentationSearch::TabName);
+			FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(SDocumentationLinkUsage::TabName);
+			FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(SDocumentationLinkGC::TabName);
+		}
+	}
+
 	void RegisterToolMenu()
 	{		
 		if (UToolMenu* Menu = UToolMenus::Get()->ExtendMenu("ContentBrowser.AssetContextMenu"))
@@ -117,25 +395,30 @@ private:
 
 					const UDocumentationUtilities* Settings = GetDefault<UDocumentationUtilities>();
 
+					FDocumentationLinkReadScope Snapshot;
+					TStringBuilder<FName::StringBufferSize> Path;
+
 					for (const FAssetData& AssetData : Context->SelectedAssets)
 					{
 						{
-							FString Path = AssetData.GetObjectPathString();
-							FString Address = UDocumentationUtilities::ResolveLink(Path);
-							bool bIsValidLink = !Address.IsEmpty() && Address != Path;
+							Path.Reset();
+							AssetData.AppendObjectPath(Path);
+							const FString* Address = Snapshot->FindValue(Path.ToView());
+							bool bIsValidLink = Address && !Address->IsEmpty() && !FStringView(*Address).Equals(Path.ToView(), ESearchCase::IgnoreCase);
 							if (bIsValidLink || Settings->bShowUndocumentedLinks)
 							{
-								AssetDocs.Add(MakeTuple(Path, bIsValidLink ? Address : TEXT("")));
+								AssetDocs.Add(MakeTuple(FString(Path.ToView()), bIsValidLink ? *Address : TEXT("")));
 							}
 						}
 
 						{
-							FString Path = AssetData.AssetClassPath.ToString();
-							FString Address = UDocumentationUtilities::ResolveLink(Path);
-							bool bIsValidLink = !Address.IsEmpty() && Address != Path;
+							Path.Reset();
+							AssetData.AssetClassPath.AppendString(Path);
+							const FString* Address = Snapshot->FindValue(Path.ToView());
+							bool bIsValidLink = Address && !Address->IsEmpty() && !FStringView(*Address).Equals(Path.ToView(), ESearchCase::IgnoreCase);
 							if (bIsValidLink || Settings->bShowUndocumentedLinks)
 							{
-								ClassDocs.Add(MakeTuple(Path, bIsValidLink ? Address : TEXT("")));
+								ClassDocs.Add(MakeTuple(FString(Path.ToView()), bIsValidLink ? *Address : TEXT("")));
 							}
 						}
 
@@ -146,8 +429,6 @@ private:
 						}
 					}
 
-					FCanExecuteAction DeniedAction = FCanExecuteAction::CreateLambda([]() { return false; });
-
 					for (const auto& Pair : ClassDocs)
 					{
 						const FString& Path = Pair.Get<0>();
@@ -156,15 +437,11 @@ private:
 						FString Name;
 						Path.Split(TEXT("."), nullptr, &Name, ESearchCase::CaseSensitive, ESearchDir::FromEnd);
 
-						InSection.AddMenuEntry(
+						InSection.AddEntry(MakeOpenDocsEntry(
 							*FString::Printf(TEXT("OpenDocs_Class_%s"), *Path),
 							FText::Format(FText::FromString(Settings->ClassDocumentationLink), FText::FromString(Name)),
-							FText::Format(LOCTEXT("OpenDocs_ToolTip", "Click to open documentation\n{0}"), FText::FromString(Path)),
-							FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Documentation" ),
-							FUIAction(
-								FExecuteAction::CreateStatic(&IDocumentationUtilitiesEditorModule::OpenLink, Link),
-								Link.IsEmpty() ? DeniedAction : FCanExecuteAction())
-							);
+							Path,
+							!Link.IsEmpty()));
 					}
 
 					for (const auto& Pair : AssetDocs)
@@ -175,20 +452,105 @@ private:
 						FString Name;
 						Path.Split(TEXT("."), nullptr, &Name, ESearchCase::CaseSensitive, ESearchDir::FromEnd);
 
-						InSection.AddMenuEntry(
+						InSection.AddEntry(MakeOpenDocsEntry(
 							*FString::Printf(TEXT("OpenDocs_Asset_%s"), *Path),
 							FText::Format(FText::FromString(Settings->AssetDocumentationLink), FText::FromString(Name)),
-							FText::Format(LOCTEXT("OpenDocs_ToolTip", "Click to open documentation\n{0}"), FText::FromString(Path)),
-							FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Documentation" ),
-							FUIAction(
-								FExecuteAction::CreateStatic(&IDocumentationUtilitiesEditorModule::OpenLink, Link),
-								Link.IsEmpty() ? DeniedAction : FCanExecuteAction())
-							);
+							Path,
+							!Link.IsEmpty()));
 					}
 				}));
 		}
 	}
 
+	/** Menu entry as button, so hover can start prefetch of asset the link opens */
+	static FToolMenuEntry MakeOpenDocsEntry(FName Name, const FText& Label, const FString& Path, bool bEnabled)
+	{
+		TSharedRef<SWidget> Button = SNew(SButton)
+			.ButtonStyle(FAppStyle::Get(), "Menu.Button")
+			.IsEnabled(bEnabled)
+			.ToolTipText(FText::Format(LOCTEXT("OpenDocs_ToolTip", "Click to open documentation\n{0}"), FText::FromString(Path)))
+			.OnHovered_Lambda([Path]()
+			{
+				IDocumentationUtilitiesEditorModule::PrefetchLink(Path);
+			})
+			.OnClicked_Lambda([Path]()
+			{
+				FSlateApplication::Get().DismissAllMenus();
+				IDocumentationUtilitiesEditorModule::OpenLink(Path);
+				return FReply::Handled();
+			})
+			[
+				SNew(SHorizontalBox)
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.VAlign(VAlign_Center)
+				.Padding(0.f, 0.f, 6.f, 0.f)
+				[
+					SNew(SImage)
+					.Image(FAppStyle::GetBrush("Icons.Documentation"))
+					.ColorAndOpacity(FSlateColor::UseForeground())
+				]
+				+ SHorizontalBox::Slot()
+				.FillWidth(1.f)
+				.VAlign(VAlign_Center)
+				[
+					SNew(STextBlock)
+					.TextStyle(FAppStyle::Get(), "Menu.Label")
+					.Text(Label)
+				]
+			];
+
+		return FToolMenuEntry::InitWidget(Name, Button, FText::GetEmpty(), true);
+	}
+
+	void RegisterContentBrowserBadges()
+	{
+		FContentBrowserModule& ContentBrowserModule = FModuleManager::LoadModuleChecked<FContentBrowserModule>("ContentBrowser");
+		
+		BadgeGeneratorHandle = ContentBrowserModule.AddAssetViewExtraStateGenerator(FAssetViewExtraStateGenerator(
+			FOnGenerateAssetViewExtraStateIndicators::CreateStatic(&FDocumentationUtilitiesEditorModule::GenerateBadgeIcon),
+			FOnGenerateAssetViewExtraStateIndicators::CreateStatic(&FDocumentationUtilitiesEditorModule::GenerateBadgeTooltip)
+		));
+	}
+
+	void UnregisterContentBrowserBadges()
+	{
+		if (FContentBrowserModule* ContentBrowserModule = FModuleManager::GetModulePtr<FContentBrowserModule>("ContentBrowser"))
+		{
+			ContentBrowserModule->RemoveAssetViewExtraStateGenerator(BadgeGeneratorHandle);
+		}
+		BadgeGeneratorHandle.Reset();
+	}
+
+	static EVisibility GetBadgeVisibility(FSoftObjectPath AssetPath, FSoftObjectPath ClassPath)
+	{
+		// Evaluated on every paint for every visible tile, keep it to set lookups
+		if (GetDefault<UDocumentationUtilities>()->bShowContentBrowserBadges)
+		{
+			FDocumentationLinkReadScope Snapshot;
+			if (Snapshot->IsPathDocumented(AssetPath) || Snapshot->IsPathDocumented(ClassPath))
+			{
+				return EVisibility::HitTestInvisible;
+			}
+		}
+		return EVisibility::Collapsed;
+	}
+
+	static TSharedRef<SWidget> GenerateBadgeIcon(const FAssetData& AssetData)
+	{
+		return SNew(SImage)
+			.Image(FAppStyle::GetBrush("Icons.Documentation"))
+			.ColorAndOpacity(FSlateColor::UseForeground())
+			.Visibility_Static(&FDocumentationUtilitiesEditorModule::GetBadgeVisibility, AssetData.GetSoftObjectPath(), FSoftObjectPath(AssetData.AssetClassPath));
+	}
+
+	static TSharedRef<SWidget> GenerateBadgeTooltip(const FAssetData& AssetData)
+	{
+		return SNew(STextBlock)
+			.Text(LOCTEXT("DocumentedAssetTooltip", "Has documentation link"))
+			.Visibility_Static(&FDocumentationUtilitiesEditorModule::GetBadgeVisibility, AssetData.GetSoftObjectPath(), FSoftObjectPath(AssetData.AssetClassPath));
+	}
+
 	void UnregisterToolMenu()
 	{
 		if (UToolMenus* ToolMenus = UToolMenus::TryGet())
@@ -199,6 +561,9 @@ private:
 			}
 		}	
 	}
+
+private:
+	FDelegateHandle BadgeGeneratorHandle;
 };
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,168 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "DocumentationUtilitiesMemory.h"
+#include "DocumentationUtilitiesSettings.h"
+#include "DocumentationLinkSnapshot.h"
+#include "DocumentationLinkSchemes.h"
+#include "DocumentationLinkUsage.h"
+#include "DocumentationPreviewCache.h"
+#include "HintTemplate.h"
+#include "DocumentationSourceIndex.h"
+#include "DocumentationHintUtils.h"
+#include "Search/DocumentationSearchIndex.h"
+#include "Widgets/HintMarkdown.h"
+#include "HintStruct.h"
+
+#include <HAL/IConsoleManager.h>
+#include <UObject/UObjectIterator.h>
+
+LLM_DEFINE_TAG(DocumentationUtilities);
+
+
+
+namespace DocumentationUtilitiesMemory
+{
+	/** Property tree of type can hold FHintStruct, directly or inside structs and containers */
+	static bool CanContainHints(const UStruct* Type, TMap<const UStruct*, bool>& Cache);
+
+	static bool CanContainHints(const FProperty* Property, TMap<const UStruct*, bool>& Cache)
+	{
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			return StructProperty->Struct == FHintStruct::StaticStruct() || CanContainHints(StructProperty->Struct, Cache);
+		}
+		if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			return CanContainHints(ArrayProperty->Inner, Cache);
+		}
+		if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		{
+			return CanContainHints(SetProperty->ElementProp, Cache);
+		}
+		if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+		{
+			return CanContainHints(MapProperty->KeyProp, Cache) || CanContainHints(MapProperty->ValueProp, Cache);
+		}
+		return false;
+	}
+
+	static bool CanContainHints(const UStruct* Type, TMap<const UStruct*, bool>& Cache)
+	{
+		if (const bool* Cached = Cache.Find(Type))
+		{
+			return *Cached;
+		}
+
+		// Recursive types resolve to false while being visited
+		Cache.Add(Type, false);
+
+		bool bResult = false;
+		for (TFieldIterator<FProperty> It(Type, EFieldIteratorFlags::IncludeSuper); It && !bResult; ++It)
+		{
+			bResult = CanContainHints(*It, Cache);
+		}
+
+		Cache.Add(Type, bResult);
+		return bResult;
+	}
+
+	static SIZE_T GetHintAllocatedSize(const FHintStruct& Hint)
+	{
+		return Hint.HintText.GetAllocatedSize() + Hint.TooltipText.GetAllocatedSize()
+			+ Hint.LinkAddress.GetAllocatedSize() + Hint.LinkAddressPath.GetSubPathString().GetAllocatedSize();
+	}
+
+	static void PrintSize(FOutputDevice& Ar, const TCHAR* Name, int32 Num, SIZE_T Bytes)
+	{
+		Ar.Logf(TEXT("  %-28s %8d  %10.1f KB"), Name, Num, Bytes / 1024.0);
+	}
+
+	static void PrintReport(FOutputDevice& Ar)
+	{
+		const UDocumentationUtilities* Settings = GetDefault<UDocumentationUtilities>();
+
+		Ar.Logf(TEXT("DocumentationUtilities memory"));
+		Ar.Logf(TEXT("  %-28s %8s  %13s"), TEXT("Name"), TEXT("Num"), TEXT("Size"));
+
+		// Sources are labelled by identity, loaded tables sit between Links and LinksOverride
+		TMap<const TArray<FDocumentationHintLink>*, FString> SourceNames;
+		SourceNames.Add(&Settings->NativeLinks, TEXT("NativeLinks"));
+		SourceNames.Add(&Settings->RegisteredNativeLinks, TEXT("RegisteredNativeLinks"));
+		SourceNames.Add(&Settings->AssetHintLinks, TEXT("AssetHintLinks"));
+		SourceNames.Add(&Settings->Links, TEXT("Links"));
+		SourceNames.Add(&Settings->LinksOverride, TEXT("LinksOverride"));
+		for (const UDocumentationLinkTableAsset* Table : Settings->GetLoadedLinkTables())
+		{
+			if (Table)
+			{
+				SourceNames.Add(&Table->Links, Table->GetName());
+			}
+		}
+
+		for (const TArray<FDocumentationHintLink>* Source : Settings->GetSources())
+		{
+			const TArray<FDocumentationHintLink>& Links = *Source;
+
+			SIZE_T Size = Links.GetAllocatedSize();
+			for (const FDocumentationHintLink& Link : Links)
+			{
+				Size += Link.GetAllocatedSize();
+			}
+			const FString* Name = SourceNames.Find(Source);
+			PrintSize(Ar, Name ? **Name : TEXT("Links"), Links.Num(), Size);
+		}
+
+		{
+			FDocumentationLinkReadScope Snapshot;
+			PrintSize(Ar, TEXT("Link snapshot"), Snapshot->Num(), Snapshot->GetAllocatedSize());
+		}
+
+		int32 NumHints = 0;
+		SIZE_T HintBytes = 0;
+		{
+			TMap<const UStruct*, bool> ClassCache;
+			for (TObjectIterator<UObject> It; It; ++It)
+			{
+				UObject* Object = *It;
+				if (!CanContainHints(Object->GetClass(), ClassCache))
+				{
+					continue;
+				}
+
+				DocumentationHintUtils::ForEachObjectHint(Object, [&NumHints, &HintBytes](const FProperty* Property, FHintStruct& Hint)
+				{
+					NumHints++;
+					HintBytes += GetHintAllocatedSize(Hint);
+				});
+			}
+		}
+		PrintSize(Ar, TEXT("FHintStruct in objects"), NumHints, HintBytes);
+
+		int32 NumMarkdown = 0;
+		const SIZE_T MarkdownBytes = FHintMarkdownParser::GetCacheAllocatedSize(NumMarkdown);
+		PrintSize(Ar, TEXT("Markdown cache"), NumMarkdown, MarkdownBytes);
+
+		const FDocumentationLinkSchemes& Schemes = FDocumentationLinkSchemes::Get();
+		PrintSize(Ar, TEXT("Parsed link cache"), Schemes.GetNumParsedLinks(), Schemes.GetAllocatedSize());
+
+		const FDocumentationSearchIndex& SearchIndex = FDocumentationSearchIndex::Get();
+		PrintSize(Ar, TEXT("Search index"), SearchIndex.GetNumDocuments(), SearchIndex.GetAllocatedSize());
+
+		const FDocumentationSourceIndex& SourceIndex = FDocumentationSourceIndex::Get();
+		PrintSize(Ar, TEXT("Source index"), SourceIndex.GetNumTypes(), SourceIndex.GetAllocatedSize());
+
+		const FDocumentationLinkUsage& Usage = FDocumentationLinkUsage::Get();
+		PrintSize(Ar, TEXT("Link usage counters"), Usage.GetNumCounters(), Usage.GetAllocatedSize());
+
+		const FDocumentationPreviewCache& Previews = FDocumentationPreviewCache::Get();
+		PrintSize(Ar, TEXT("Page preview cache"), Previews.Num(), Previews.GetAllocatedSize());
+
+		const FHintTemplateCache& Templates = FHintTemplateCache::Get();
+		PrintSize(Ar, TEXT("Hint template cache"), Templates.Num(), Templates.GetAllocatedSize());
+	}
+
+	static FAutoConsoleCommandWithOutputDevice MemReportCommand(
+		TEXT("DocumentationUtilities.MemReport"),
+		TEXT("Print memory used by documentation link tables, hint structs, caches and indices"),
+		FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&PrintReport));
+}
@@ -0,0 +1,14 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+
+/**
+ * Allocations of link tables, snapshots, caches and indices
+ * Use LLM_SCOPE_BYTAG(DocumentationUtilities) where plugin data is created, including worker lambdas
+ *
+ * Breakdown of current use: DocumentationUtilities.MemReport
+ */
+LLM_DECLARE_TAG(DocumentationUtilities);
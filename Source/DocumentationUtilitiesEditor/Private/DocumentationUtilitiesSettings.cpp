@@ -2,8 +2,19 @@
 
 
 #include "DocumentationUtilitiesSettings.h"
+#include "DocumentationLinkSnapshot.h"
+#include "DocumentationHintUtils.h"
+#include "DocumentationUtilitiesMemory.h"
+#include "DocumentationNativeHintCollector.h"
+#include "DocumentationLinkTableCooker.h"
+#include "DocumentationNativeLinks.h"
+#include "DocumentationPreviewCache.h"
 #include <UObject/ObjectSaveContext.h>
+#include <ScopedTransaction.h>
+#include <Engine/AssetManager.h>
+#include <Engine/StreamableManager.h>
 #include <ProfilingDebugging/ScopedTimers.h>
+#include <AssetRegistry/IAssetRegistry.h>
 
 bool FDocumentationHintLink::ExportTextItem(FString& ValueStr, FDocumentationHintLink const& DefaultValue, UObject* Parent, int32 PortFlags, UObject* ExportRootScope) const
 {
@@ -31,6 +42,7 @@ bool FDocumentationHintLink::ImportTextItem(const TCHAR*& Buffer, int32 PortFlag
 	case EDocumentationLinkType::Class: ClassKey = StringKey; StringKey.Empty(); break;
 	case EDocumentationLinkType::String: break;
 	case EDocumentationLinkType::Native: break;	
+	case EDocumentationLinkType::AssetHint: break;
 	}
 
 	return true;
@@ -38,10 +50,37 @@ bool FDocumentationHintLink::ImportTextItem(const TCHAR*& Buffer, int32 PortFlag
 
 
 
+void UDocumentationLinkTableAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	UDocumentationUtilities* Settings = GetMutableDefault<UDocumentationUtilities>();
+	if (Settings->IsLinkTableLoaded(this))
+	{
+		Settings->RebuildLinkSnapshot();
+	}
+}
+
+void UDocumentationLinkTableAsset::PostEditUndo()
+{
+	Super::PostEditUndo();
+
+	UDocumentationUtilities* Settings = GetMutableDefault<UDocumentationUtilities>();
+	if (Settings->IsLinkTableLoaded(this))
+	{
+		Settings->RebuildLinkSnapshot();
+	}
+}
+
+
+
 UDocumentationUtilities::UDocumentationUtilities(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
+	bMarkdownHints = true;
+
 	MaxContentBrowserLinks = 4;
+	bShowContentBrowserBadges = true;
 
 	ClassDocumentationLink = TEXT("Class Documentation - {0}");
 	AssetDocumentationLink = TEXT("Asset Documentation - {0}");
@@ -49,7 +88,14 @@ UDocumentationUtilities::UDocumentationUtilities(const FObjectInitializer& Objec
 	bCollectNativeHints = true;
 	bRemoveOldNativeHints = true;
 
+	bIndexSourceFiles = true;
+
+	bCollectAssetHints = true;
+	bRemoveOldAssetHints = true;
+	bCookRuntimeLinkTable = false;
+
 	bLinksPicker_ShowNative = true;
+	bLinksPicker_ShowAssetHints = true;
 	bLinksPicker_ShowString = true;
 	bLinksPicker_ShowAsset = true;
 	bLinksPicker_ShowClass = true;	
@@ -67,77 +113,376 @@ void UDocumentationUtilities::PreSave(FObjectPreSaveContext ObjectSaveContext)
 
 void UDocumentationUtilities::PostInitProperties()
 {
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+
 	Super::PostInitProperties();
 
-	if (bCollectNativeHints)
+	// Settings are edited on CDO, without the flag Modify records nothing and edits cannot be undone
+	if (HasAnyFlags(RF_ClassDefaultObject))
 	{
-		TMap<FString, FString> OldNativeLinks = CollectLinksOfType(EDocumentationLinkType::Native);		
-		
-		TMap<FString, FString> ValidNativeLinks;
-		for (TObjectIterator<UClass> ClassIt; ClassIt; ++ClassIt)
-		{
-			UClass* Class = *ClassIt;
-			const UObject* CDO = Class->GetDefaultObject();
+		SetFlags(RF_Transactional);
+	}
 
-			for (TFieldIterator<FStructProperty> PropertyIt(Class, EFieldIteratorFlags::IncludeSuper); PropertyIt; ++PropertyIt)
-			{
-				FStructProperty* Prop = *PropertyIt;
-				if (Prop->Struct == FHintStruct::StaticStruct())
-				{
-					const FHintStruct* Value = Prop->ContainerPtrToValuePtr<FHintStruct>(CDO);
-					
-					FString LinkKey = Value ? Value->GetLink() : TEXT("");
-					if (!LinkKey.IsEmpty())
-					{
-						const FString* OldLink = OldNativeLinks.Find(LinkKey);
-						ValidNativeLinks.Add(LinkKey, OldLink ? *OldLink : TEXT(""));
-					}					
-				}
-			}
-		}		
+	// Native links are collected after engine init by FDocumentationNativeHintCollector, values from config are used until then
+	// Registered links need no scan and are available right away
+	MergeRegisteredNativeLinks();
+	RebuildLinkSnapshot();
+}
+
+void UDocumentationUtilities::SetNativeLinkKeys(const TSet<FString>& LinkKeys)
+{
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
 
-		for (TObjectIterator<UScriptStruct> StructIt; StructIt; ++StructIt)
+	// Only config values, registered addresses are kept in RegisteredNativeLinks
+	TMap<FString, FString> OldNativeLinks;
+	for (const FDocumentationHintLink& Link : NativeLinks)
+	{
+		if (Link.HasValue())
 		{
-			UScriptStruct* Struct = *StructIt;
-			for (TFieldIterator<FStructProperty> PropertyIt(Struct, EFieldIteratorFlags::IncludeSuper); PropertyIt; ++PropertyIt)
-			{
-				FStructProperty* Prop = *PropertyIt;
-				if (Prop->Struct == FHintStruct::StaticStruct())
-				{
-					FStructOnScope DefaultStruct(Struct);
-					
-					const FHintStruct* Value = Prop->ContainerPtrToValuePtr<FHintStruct>(DefaultStruct.GetStructMemory());
-					
-					FString LinkKey = Value ? Value->GetLink() : TEXT("");
-					if (!LinkKey.IsEmpty())
-					{
-						const FString* OldLink = OldNativeLinks.Find(LinkKey);
-						ValidNativeLinks.Add(LinkKey, OldLink ? *OldLink : TEXT(""));
-					}	
-				}
-			}
+			OldNativeLinks.Add(Link.GetLinkKey(), Link.Value);
 		}
-		ValidNativeLinks.KeyStableSort([](const FString& A, const FString& B) { return A < B; });
+	}
 
-		if (bRemoveOldNativeHints)
+	TSet<FString> AllLinkKeys = LinkKeys;
+	FDocumentationNativeLink::ForEach([&AllLinkKeys](const FDocumentationNativeLink& Registered)
+	{
+		if (const UObject* Type = Registered.GetType())
 		{
-			NativeLinks.Reset();
+			AllLinkKeys.Add(Type->GetPathName());
 		}
-		else
+	});
+
+	TMap<FString, FString> ValidNativeLinks;
+	for (const FString& LinkKey : AllLinkKeys)
+	{
+		const FString* OldLink = OldNativeLinks.Find(LinkKey);
+		ValidNativeLinks.Add(LinkKey, OldLink ? *OldLink : TEXT(""));
+	}
+	ValidNativeLinks.KeyStableSort([](const FString& A, const FString& B) { return A < B; });
+
+	if (bRemoveOldNativeHints)
+	{
+		NativeLinks.Reset();
+	}
+	else
+	{
+		NativeLinks.RemoveAll([&ValidNativeLinks](const FDocumentationHintLink& Entry) { return ValidNativeLinks.Contains(Entry.GetLinkKey()); });
+	}
+
+	for (const auto& Pair : ValidNativeLinks)
+	{
+		FDocumentationHintLink NativeLink;
+		NativeLink.Type = EDocumentationLinkType::Native;
+		NativeLink.StringKey = Pair.Key;
+		NativeLink.Value = Pair.Value;
+
+		NativeLinks.Add(NativeLink);
+	}
+
+	MergeRegisteredNativeLinks();
+	RebuildLinkSnapshot();
+}
+
+void UDocumentationUtilities::MergeRegisteredNativeLinks()
+{
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+
+	RegisteredNativeLinks.Reset();
+
+	bool bAdded = false;
+	FDocumentationNativeLink::ForEach([this, &bAdded](const FDocumentationNativeLink& Registered)
+	{
+		const UObject* Type = Registered.GetType();
+		if (Type == nullptr)
 		{
-			NativeLinks.RemoveAll([ValidNativeLinks](const FDocumentationHintLink& Entry) { return ValidNativeLinks.Contains(Entry.GetLinkKey()); });
+			return;
 		}
 
-		for (const auto& Pair : ValidNativeLinks)
+		FDocumentationHintLink& RegisteredLink = RegisteredNativeLinks.AddDefaulted_GetRef();
+		RegisteredLink.Type = EDocumentationLinkType::Native;
+		RegisteredLink.StringKey = Type->GetPathName();
+		RegisteredLink.Value = Registered.Address;
+
+		// NativeLinks keeps the key with config value only, so address changed in code is not shadowed by saved copy
+		FDocumentationHintLink* Existing = NativeLinks.FindByPredicate([&RegisteredLink](const FDocumentationHintLink& Entry) { return Entry.GetLinkKey() == RegisteredLink.StringKey; });
+		if (Existing == nullptr)
 		{
 			FDocumentationHintLink NativeLink;
 			NativeLink.Type = EDocumentationLinkType::Native;
-			NativeLink.StringKey = Pair.Key;
-			NativeLink.Value = Pair.Value;
-
+			NativeLink.StringKey = RegisteredLink.StringKey;
 			NativeLinks.Add(NativeLink);
+			bAdded = true;
+		}
+		else if (Existing->Value == RegisteredLink.Value)
+		{
+			// Saved to config by earlier versions that merged addresses into NativeLinks
+			Existing->Value.Empty();
+		}
+	});
+
+	if (bAdded)
+	{
+		NativeLinks.StableSort([](const FDocumentationHintLink& A, const FDocumentationHintLink& B) { return A.GetLinkKey() < B.GetLinkKey(); });
+	}
+}
+
+void UDocumentationUtilities::EnsureNativeLinksCollected()
+{
+	FDocumentationNativeHintCollector::Get().Finish();
+}
+
+void UDocumentationUtilities::LoadLinkTables()
+{
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+
+	LinkTablesGeneration++;
+	LinkTableHandles.Reset();
+	LoadedLinkTables.Reset();
+	LoadedLinkTables.SetNum(LinkTables.Num());
+
+	// Tables already in memory are used right away, so reload does not drop their links until callback
+	for (int32 Index = 0; Index < LinkTables.Num(); Index++)
+	{
+		LoadedLinkTables[Index] = LinkTables[Index].Get();
+	}
+	RebuildLinkSnapshot();
+
+	if (!UAssetManager::IsInitialized())
+	{
+		return;
+	}
+
+	FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
+	for (int32 Index = 0; Index < LinkTables.Num(); Index++)
+	{
+		const FSoftObjectPath Path = LinkTables[Index].ToSoftObjectPath();
+		if (Path.IsNull())
+		{
+			continue;
+		}
+
+		// Separate request per table, so each is merged as soon as it arrives
+		TSharedPtr<FStreamableHandle> Handle = Streamable.RequestAsyncLoad(Path,
+			FStreamableDelegate::CreateUObject(this, &UDocumentationUtilities::OnLinkTableLoaded, Index, LinkTablesGeneration),
+			FStreamableManager::AsyncLoadHighPriority);
+
+		if (Handle.IsValid())
+		{
+			LinkTableHandles.Add(Handle);
+		}
+	}
+}
+
+void UDocumentationUtilities::EnsureLinkTablesLoaded()
+{
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+
+	UDocumentationUtilities* Settings = GetMutableDefault<UDocumentationUtilities>();
+	if (Settings->LoadedLinkTables.Num() != Settings->LinkTables.Num())
+	{
+		Settings->LoadLinkTables();
+	}
+
+	for (const TSharedPtr<FStreamableHandle>& Handle : Settings->LinkTableHandles)
+	{
+		Handle->WaitUntilComplete();
+	}
+
+	// Completion callbacks may run later, tables are taken here so snapshot is complete on return
+	bool bChanged = false;
+	for (int32 Index = 0; Index < Settings->LinkTables.Num(); Index++)
+	{
+		UDocumentationLinkTableAsset* Table = Settings->LinkTables[Index].IsNull() ? nullptr : Settings->LinkTables[Index].LoadSynchronous();
+		if (Table && Settings->LoadedLinkTables[Index] != Table)
+		{
+			Settings->LoadedLinkTables[Index] = Table;
+			bChanged = true;
+		}
+	}
+
+	if (bChanged)
+	{
+		Settings->RebuildLinkSnapshot();
+	}
+}
+
+void UDocumentationUtilities::OnLinkTableLoaded(int32 Index, int32 Generation)
+{
+	if (Generation != LinkTablesGeneration || !LinkTables.IsValidIndex(Index) || !LoadedLinkTables.IsValidIndex(Index))
+	{
+		return;
+	}
+
+	LoadedLinkTables[Index] = LinkTables[Index].Get();
+	if (LoadedLinkTables[Index])
+	{
+		RebuildLinkSnapshot();
+	}
+}
+
+int32 UDocumentationUtilities::EditLinks(const TMap<FString, FString>& LinksToSet, const TArray<FString>& LinksToRemove, bool bSaveConfig)
+{
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+
+	if (LinksToSet.Num() == 0 && LinksToRemove.Num() == 0)
+	{
+		return 0;
+	}
+
+	FScopedTransaction Transaction(NSLOCTEXT("DocumentationUtilities", "EditLinks", "Edit Documentation Links"));
+	Modify();
+
+	// One pass to index keys, so each edit is a lookup instead of a scan
+	TMap<FString, int32> KeyToIndex;
+	KeyToIndex.Reserve(Links.Num());
+	for (int32 Index = 0; Index < Links.Num(); Index++)
+	{
+		KeyToIndex.Add(Links[Index].GetLinkKey(), Index);
+	}
+
+	int32 NumChanged = 0;
+	for (const auto& Pair : LinksToSet)
+	{
+		if (const int32* Index = KeyToIndex.Find(Pair.Key))
+		{
+			FDocumentationHintLink& Existing = Links[*Index];
+			if (!Existing.Value.Equals(Pair.Value, ESearchCase::CaseSensitive))
+			{
+				Existing.Value = Pair.Value;
+				NumChanged++;
+			}
+		}
+		else
+		{
+			FDocumentationHintLink& NewLink = Links.AddDefaulted_GetRef();
+			NewLink.Type = EDocumentationLinkType::String;
+			NewLink.StringKey = Pair.Key;
+			NewLink.Value = Pair.Value;
+			KeyToIndex.Add(Pair.Key, Links.Num() - 1);
+			NumChanged++;
 		}
 	}
+
+	if (LinksToRemove.Num() > 0)
+	{
+		TSet<FString> RemovedKeys(LinksToRemove);
+		NumChanged += Links.RemoveAll([&RemovedKeys](const FDocumentationHintLink& Entry) { return RemovedKeys.Contains(Entry.GetLinkKey()); });
+	}
+
+	if (NumChanged == 0)
+	{
+		Transaction.Cancel();
+		return 0;
+	}
+
+	Links.StableSort([](const FDocumentationHintLink& A, const FDocumentationHintLink& B)
+	{
+		return A.GetLinkKey() < B.GetLinkKey();
+	});
+
+	RebuildLinkSnapshot();
+
+	if (bSaveConfig)
+	{
+		TryUpdateDefaultConfigFile();
+	}
+	return NumChanged;
+}
+
+void UDocumentationUtilities::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UDocumentationUtilities, bCookRuntimeLinkTable) && bCookRuntimeLinkTable)
+	{
+		FDocumentationLinkTableCooker::AddStagedDirectory();
+	}
+
+	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UDocumentationUtilities, LinkTables))
+	{
+		LoadLinkTables();
+	}
+
+	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UDocumentationUtilities, DocsPreviewDirectory))
+	{
+		FDocumentationPreviewCache::Get().Reset();
+	}
+
+	RebuildLinkSnapshot();
+}
+
+void UDocumentationUtilities::CollectAssetHints()
+{
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+
+	if (!bCollectAssetHints)
+	{
+		return;
+	}
+
+	IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+	if (AssetRegistry == nullptr)
+	{
+		return;
+	}
+
+	TMap<FString, FString> OldAssetLinks = CollectLinksOfType(EDocumentationLinkType::AssetHint);
+
+	TSet<FString> NativeKeys;
+	for (const FDocumentationHintLink& NativeLink : NativeLinks)
+	{
+		NativeKeys.Add(NativeLink.GetLinkKey());
+	}
+
+	TMap<FString, FString> ValidAssetLinks;
+	DocumentationHintUtils::ForEachAssetHintLink(*AssetRegistry, [&NativeKeys, &OldAssetLinks, &ValidAssetLinks](FName PackageName, const FString& LinkKey)
+	{
+		if (!NativeKeys.Contains(LinkKey) && !ValidAssetLinks.Contains(LinkKey))
+		{
+			const FString* OldLink = OldAssetLinks.Find(LinkKey);
+			ValidAssetLinks.Add(LinkKey, OldLink ? *OldLink : TEXT(""));
+		}
+	});
+	ValidAssetLinks.KeyStableSort([](const FString& A, const FString& B) { return A < B; });
+
+	if (bRemoveOldAssetHints)
+	{
+		AssetHintLinks.Reset();
+	}
+	else
+	{
+		AssetHintLinks.RemoveAll([&ValidAssetLinks](const FDocumentationHintLink& Entry) { return ValidAssetLinks.Contains(Entry.GetLinkKey()); });
+	}
+
+	for (const auto& Pair : ValidAssetLinks)
+	{
+		FDocumentationHintLink AssetLink;
+		AssetLink.Type = EDocumentationLinkType::AssetHint;
+		AssetLink.StringKey = Pair.Key;
+		AssetLink.Value = Pair.Value;
+
+		AssetHintLinks.Add(AssetLink);
+	}
+
+	RebuildLinkSnapshot();
+}
+
+void UDocumentationUtilities::PostEditUndo()
+{
+	Super::PostEditUndo();
+
+	// LinkTables may have changed, reload also rebuilds snapshot
+	LoadLinkTables();
+
+	// Links edits are written to config right away, undo must restore the file as well
+	TryUpdateDefaultConfigFile();
+}
+
+void UDocumentationUtilities::PostReloadConfig(FProperty* PropertyThatWasLoaded)
+{
+	Super::PostReloadConfig(PropertyThatWasLoaded);
+
+	LoadLinkTables();
 }
 
 const FDocumentationHintLink* UDocumentationUtilities::FindLinkByKey(const FString& Link)
@@ -163,13 +508,28 @@ const FDocumentationHintLink* UDocumentationUtilities::FindLinkByKey(const FStri
 
 bool UDocumentationUtilities::HasLinkRedirector(const FString& Link)
 {
-	return FindLinkByKey(Link) != nullptr;
+	FDocumentationLinkReadScope Snapshot;
+	return Snapshot->FindValue(Link) != nullptr;
 }
 
 FString UDocumentationUtilities::ResolveLink(const FString& Link)
 {
-	const FDocumentationHintLink* Redirector = FindLinkByKey(Link);
-	return Redirector ? Redirector->Value : Link;
+	FDocumentationLinkReadScope Snapshot;
+	const FString* Value = Snapshot->FindValue(Link);
+	return Value ? *Value : Link;
+}
+
+bool UDocumentationUtilities::ResolveLink(FStringView Link, FStringBuilderBase& OutAddress)
+{
+	FDocumentationLinkReadScope Snapshot;
+	const FString* Value = Snapshot->FindValue(Link);
+	OutAddress.Append(Value ? FStringView(*Value) : Link);
+	return Value != nullptr;
+}
+
+void UDocumentationUtilities::ResolveLinks(TConstArrayView<FStringView> Links, TArrayView<FStringView> OutAddresses, const FDocumentationLinkReadScope& Snapshot)
+{
+	Snapshot->ResolveLinks(Links, OutAddresses);
 }
 
 TMap<FString, FString> UDocumentationUtilities::CollectLinksOfType(EDocumentationLinkType Type) const
@@ -182,12 +542,28 @@ TMap<FString, FString> UDocumentationUtilities::CollectLinksOfType(EDocumentatio
 		const TArray<FDocumentationHintLink>& Source = *SourcePtr;
 		for (const FDocumentationHintLink& Link : Source)
 		{
-			if (Link.IsValid() && Link.Type == Type)
+			if (Link.Type != Type || !Link.HasKey())
+			{
+				continue;
+			}
+
+			// Empty value must not hide value of another source
+			FString& Value = Map.FindOrAdd(Link.GetLinkKey());
+			if (Link.HasValue())
 			{
-				Map.Add(Link.GetLinkKey(), Link.Value);			
+				Value = Link.Value;
 			}
 		}
 	}
 	return Map;
 }
 
+void UDocumentationUtilities::RebuildLinkSnapshot()
+{
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+
+	if (HasAnyFlags(RF_ClassDefaultObject))
+	{
+		FDocumentationLinkSnapshot::Publish(FDocumentationLinkSnapshot::Build(*this));
+	}
+}
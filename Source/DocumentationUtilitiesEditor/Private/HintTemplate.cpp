@@ -0,0 +1,306 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "HintTemplate.h"
+#include "DocumentationUtilitiesMemory.h"
+#include "DocumentationUtilitiesSettings.h"
+#include "Widgets/HintMarkdown.h"
+
+#include <UObject/UObjectGlobals.h>
+#include <UObject/TextProperty.h>
+#include <UObject/EnumProperty.h>
+
+
+
+namespace HintTemplate
+{
+	/** Resolve "A.B.C", every part but the last must be struct property */
+	static bool ResolveChain(const UStruct* Type, FStringView Path, TArray<const FProperty*, TInlineAllocator<2>>& OutChain)
+	{
+		while (Type)
+		{
+			int32 Dot = INDEX_NONE;
+			const bool bHasMore = Path.FindChar(TEXT('.'), Dot);
+			const FName Name(bHasMore ? Path.Left(Dot) : Path, FNAME_Find);
+			if (Name.IsNone())
+			{
+				return false;
+			}
+
+			const FProperty* Property = FindFProperty<FProperty>(Type, Name);
+			if (Property == nullptr)
+			{
+				return false;
+			}
+			OutChain.Add(Property);
+
+			if (!bHasMore)
+			{
+				return true;
+			}
+
+			const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+			Type = StructProperty ? StructProperty->Struct : nullptr;
+			Path.RightChopInline(Dot + 1);
+		}
+		return false;
+	}
+}
+
+FHintTemplate::FHintTemplate(const UStruct* Type, const FString& Template)
+{
+	FString Literal;
+	const int32 Len = Template.Len();
+	for (int32 Index = 0; Index < Len; Index++)
+	{
+		const TCHAR Char = Template[Index];
+		const bool bDoubled = Index + 1 < Len && Template[Index + 1] == Char;
+
+		if ((Char == TEXT('{') || Char == TEXT('}')) && bDoubled)
+		{
+			Literal.AppendChar(Char);
+			Index++;
+			continue;
+		}
+
+		int32 Close = INDEX_NONE;
+		if (Char == TEXT('{') && FStringView(Template).RightChop(Index + 1).FindChar(TEXT('}'), Close))
+		{
+			const FStringView Path = FStringView(Template).Mid(Index + 1, Close).TrimStartAndEnd();
+
+			FSegment Placeholder;
+			if (Type && HintTemplate::ResolveChain(Type, Path, Placeholder.PropertyChain))
+			{
+				if (!Literal.IsEmpty())
+				{
+					Segments.Add({ MoveTemp(Literal), {} });
+					Literal.Reset();
+				}
+				Segments.Add(MoveTemp(Placeholder));
+				bHasPlaceholders = true;
+			}
+			else
+			{
+				// Unknown names stay visible, so typos are easy to notice
+				Literal.Append(FStringView(Template).Mid(Index, Close + 2));
+			}
+			Index += Close + 1;
+			continue;
+		}
+
+		Literal.AppendChar(Char);
+	}
+
+	if (!Literal.IsEmpty())
+	{
+		Segments.Add({ MoveTemp(Literal), {} });
+	}
+}
+
+void FHintTemplate::Format(const void* Container, FString& Out, bool bEscapeMarkdown) const
+{
+	Out.Reset();
+	FString ValueText;
+	for (const FSegment& Segment : Segments)
+	{
+		if (Segment.PropertyChain.Num() == 0)
+		{
+			Out.Append(Segment.Text);
+			continue;
+		}
+
+		const void* Value = Container;
+		for (const FProperty* Property : Segment.PropertyChain)
+		{
+			Value = Property->ContainerPtrToValuePtr<void>(Value);
+		}
+		if (bEscapeMarkdown)
+		{
+			ValueText.Reset();
+			AppendValue(Segment.PropertyChain.Last(), Value, ValueText);
+			FHintMarkdownParser::AppendEscaped(ValueText, Out);
+		}
+		else
+		{
+			AppendValue(Segment.PropertyChain.Last(), Value, Out);
+		}
+	}
+}
+
+void FHintTemplate::AppendValue(const FProperty* Property, const void* Value, FString& Out)
+{
+	if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+	{
+		Out.Append(BoolProperty->GetPropertyValue(Value) ? TEXT("true") : TEXT("false"));
+	}
+	else if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+	{
+		const int64 EnumValue = EnumProperty->GetUnderlyingProperty()->GetSignedIntPropertyValue(Value);
+		Out.Append(EnumProperty->GetEnum()->GetDisplayNameTextByValue(EnumValue).ToString());
+	}
+	else if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+	{
+		if (const UEnum* Enum = NumericProperty->GetIntPropertyEnum())
+		{
+			Out.Append(Enum->GetDisplayNameTextByValue(NumericProperty->GetSignedIntPropertyValue(Value)).ToString());
+		}
+		else if (NumericProperty->IsFloatingPoint())
+		{
+			Out.Append(FString::SanitizeFloat(NumericProperty->GetFloatingPointPropertyValue(Value)));
+		}
+		else
+		{
+			Out.Append(NumericProperty->GetNumericPropertyValueToString(Value));
+		}
+	}
+	else if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+	{
+		Out.Append(StrProperty->GetPropertyValue(Value));
+	}
+	else if (const FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+	{
+		NameProperty->GetPropertyValue(Value).AppendString(Out);
+	}
+	else if (const FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+	{
+		Out.Append(TextProperty->GetPropertyValue(Value).ToString());
+	}
+	else if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+	{
+		const UObject* Object = ObjectProperty->GetObjectPropertyValue(Value);
+		Out.Append(Object ? Object->GetName() : TEXT("None"));
+	}
+	else
+	{
+		Property->ExportTextItem_Direct(Out, Value, nullptr, nullptr, PPF_None);
+	}
+}
+
+SIZE_T FHintTemplate::GetAllocatedSize() const
+{
+	SIZE_T Size = Segments.GetAllocatedSize();
+	for (const FSegment& Segment : Segments)
+	{
+		Size += Segment.Text.GetAllocatedSize() + Segment.PropertyChain.GetAllocatedSize();
+	}
+	return Size;
+}
+
+
+
+FHintTemplateCache& FHintTemplateCache::Get()
+{
+	static FHintTemplateCache Instance;
+	return Instance;
+}
+
+void FHintTemplateCache::Initialize()
+{
+	// Compiled Blueprints and reloaded native classes get new properties, cached pointers would dangle
+	ReinstancedHandle = FCoreUObjectDelegates::OnObjectsReinstanced.AddLambda([this](const FCoreUObjectDelegates::FReplacementObjectMap&)
+	{
+		Reset();
+	});
+	ReloadHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason)
+	{
+		Reset();
+	});
+}
+
+void FHintTemplateCache::Shutdown()
+{
+	FCoreUObjectDelegates::OnObjectsReinstanced.Remove(ReinstancedHandle);
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadHandle);
+	ReinstancedHandle.Reset();
+	ReloadHandle.Reset();
+
+	Reset();
+}
+
+TSharedRef<const FHintTemplate> FHintTemplateCache::FindOrCompile(const UStruct* Type, const FString& Template)
+{
+	check(IsInGameThread());
+
+	const TPair<FObjectKey, FString> Key(FObjectKey(Type), Template);
+	if (const TSharedRef<const FHintTemplate>* Cached = Templates.Find(Key))
+	{
+		return *Cached;
+	}
+
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+	return Templates.Add(Key, MakeShared<const FHintTemplate>(Type, Template));
+}
+
+TAttribute<FText> FHintTemplateCache::MakeText(const UObject* Owner, const FString& Template)
+{
+	if (Owner == nullptr || !FHintTemplate::MayHavePlaceholders(Template))
+	{
+		return FText::FromString(Template);
+	}
+
+	struct FState
+	{
+		TWeakObjectPtr<const UObject> Owner;
+		FString Template;
+		TSharedPtr<const FHintTemplate> Compiled;
+		uint32 Generation = 0;
+		bool bEscapeMarkdown = false;
+		FString Formatted;
+		FString Scratch;
+		FText Text;
+	};
+
+	TSharedRef<FState> State = MakeShared<FState>();
+	State->Owner = Owner;
+	State->Template = Template;
+	State->Compiled = FindOrCompile(Owner->GetClass(), Template);
+	State->Generation = Generation;
+	State->bEscapeMarkdown = GetDefault<UDocumentationUtilities>()->bMarkdownHints;
+	State->Compiled->Format(Owner, State->Formatted, State->bEscapeMarkdown);
+	State->Text = FText::FromString(State->Formatted);
+
+	if (!State->Compiled->HasPlaceholders())
+	{
+		return State->Text;
+	}
+
+	return TAttribute<FText>::CreateLambda([State]()
+	{
+		const UObject* Object = State->Owner.Get();
+		if (Object == nullptr)
+		{
+			return State->Text;
+		}
+
+		FHintTemplateCache& Cache = FHintTemplateCache::Get();
+		if (State->Generation != Cache.GetGeneration())
+		{
+			State->Compiled = Cache.FindOrCompile(Object->GetClass(), State->Template);
+			State->Generation = Cache.GetGeneration();
+		}
+
+		// New FText only when a value changed, so text widgets skip relayout
+		State->Compiled->Format(Object, State->Scratch, State->bEscapeMarkdown);
+		if (!State->Scratch.Equals(State->Formatted, ESearchCase::CaseSensitive))
+		{
+			Swap(State->Formatted, State->Scratch);
+			State->Text = FText::FromString(State->Formatted);
+		}
+		return State->Text;
+	});
+}
+
+void FHintTemplateCache::Reset()
+{
+	Templates.Reset();
+	Generation++;
+}
+
+SIZE_T FHintTemplateCache::GetAllocatedSize() const
+{
+	SIZE_T Size = Templates.GetAllocatedSize();
+	for (const auto& Pair : Templates)
+	{
+		Size += Pair.Key.Value.GetAllocatedSize() + sizeof(FHintTemplate) + Pair.Value->GetAllocatedSize();
+	}
+	return Size;
+}
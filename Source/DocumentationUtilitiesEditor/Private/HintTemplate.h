@@ -0,0 +1,84 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+/**
+ * Hint text with {Property} placeholders, parsed once with resolved properties
+ *
+ * "Spawns {MaxCount} enemies every {Spawn.Interval}s" reads MaxCount and nested Spawn.Interval of the owner
+ * Use {{ and }} for braces. Placeholders that do not name a property are kept as written
+ */
+class FHintTemplate
+{
+public:
+	/** Parse Template against properties of Type */
+	FHintTemplate(const UStruct* Type, const FString& Template);
+
+	/** Template has at least one resolved placeholder */
+	bool HasPlaceholders() const { return bHasPlaceholders; }
+
+	/** Write text with values of Container, which must be instance of Type. Values are escaped when text is shown as markdown */
+	void Format(const void* Container, FString& Out, bool bEscapeMarkdown = false) const;
+
+	SIZE_T GetAllocatedSize() const;
+
+	/** Quick check before parsing, most hints are plain text */
+	static bool MayHavePlaceholders(const FString& Text) { return Text.Contains(TEXT("{"), ESearchCase::CaseSensitive); }
+
+private:
+	static void AppendValue(const FProperty* Property, const void* Value, FString& Out);
+
+	struct FSegment
+	{
+		/** Literal text, or text written when property chain is empty */
+		FString Text;
+
+		/** Outer to inner, each next property is member of previous struct property */
+		TArray<const FProperty*, TInlineAllocator<2>> PropertyChain;
+	};
+
+	TArray<FSegment> Segments;
+	bool bHasPlaceholders = false;
+};
+
+/**
+ * Compiled hint templates keyed by owner type and template text
+ *
+ * Entries are dropped when classes are reinstanced or reloaded, since their properties are recreated
+ * Game thread only
+ */
+class FHintTemplateCache
+{
+public:
+	static FHintTemplateCache& Get();
+
+	void Initialize();
+	void Shutdown();
+
+	/** Compiled template, parsed on first request */
+	TSharedRef<const FHintTemplate> FindOrCompile(const UStruct* Type, const FString& Template);
+
+	/**
+	 * Text of template evaluated against Owner
+	 * Returns bound attribute when template has placeholders, it formats on each call and reuses text while values are unchanged
+	 */
+	TAttribute<FText> MakeText(const UObject* Owner, const FString& Template);
+
+	void Reset();
+
+	/** Changes on every reset, holders of compiled templates must look them up again */
+	uint32 GetGeneration() const { return Generation; }
+
+	int32 Num() const { return Templates.Num(); }
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	TMap<TPair<FObjectKey, FString>, TSharedRef<const FHintTemplate>> Templates;
+	uint32 Generation = 0;
+
+	FDelegateHandle ReinstancedHandle;
+	FDelegateHandle ReloadHandle;
+};
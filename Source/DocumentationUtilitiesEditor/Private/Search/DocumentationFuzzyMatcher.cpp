@@ -0,0 +1,237 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "DocumentationFuzzyMatcher.h"
+
+
+
+namespace DocumentationFuzzyMatcher
+{
+	static constexpr int32 ScoreMatch = 16;
+	static constexpr int32 BonusFirstChar = 12;
+	static constexpr int32 BonusBoundary = 10;
+	static constexpr int32 BonusCamelCase = 8;
+	static constexpr int32 BonusConsecutive = 6;
+	static constexpr int32 PenaltyGapStart = 3;
+	static constexpr int32 PenaltyGapExtension = 1;
+
+	static bool IsSeparator(TCHAR Char)
+	{
+		return Char == TEXT('/') || Char == TEXT('.') || Char == TEXT('_') || Char == TEXT(':') || Char == TEXT(' ') || Char == TEXT('-');
+	}
+
+	static int32 GetPositionBonus(FStringView Key, int32 Position)
+	{
+		if (Position == 0)
+		{
+			return BonusFirstChar;
+		}
+
+		const TCHAR Prev = Key[Position - 1];
+		const TCHAR Current = Key[Position];
+		if (IsSeparator(Prev))
+		{
+			return BonusBoundary;
+		}
+		if (FChar::IsLower(Prev) && FChar::IsUpper(Current))
+		{
+			return BonusCamelCase;
+		}
+		if (!FChar::IsDigit(Prev) && FChar::IsDigit(Current))
+		{
+			return BonusCamelCase;
+		}
+		return 0;
+	}
+
+	static bool IsWorse(const FDocumentationFuzzyMatcher::FMatch& A, const FDocumentationFuzzyMatcher::FMatch& B)
+	{
+		return A.Score < B.Score || (A.Score == B.Score && A.Index > B.Index);
+	}
+}
+
+
+
+void FDocumentationFuzzyMatcher::Reset(TArray<FString>&& InKeys)
+{
+	Keys = MoveTemp(InKeys);
+
+	LowerKeys.Reset(Keys.Num());
+	Masks.Reset(Keys.Num());
+	for (const FString& Key : Keys)
+	{
+		FString& Lower = LowerKeys.Add_GetRef(Key.ToLower());
+		Masks.Add(MakeCharMask(Lower));
+	}
+
+	LastQuery.Reset();
+	LastCandidates.Reset();
+}
+
+uint64 FDocumentationFuzzyMatcher::MakeCharMask(FStringView LowerText)
+{
+	uint64 Mask = 0;
+	for (TCHAR Char : LowerText)
+	{
+		if (Char >= TEXT('a') && Char <= TEXT('z'))
+		{
+			Mask |= 1ull << (Char - TEXT('a'));
+		}
+		else if (Char >= TEXT('0') && Char <= TEXT('9'))
+		{
+			Mask |= 1ull << (26 + Char - TEXT('0'));
+		}
+		else
+		{
+			Mask |= 1ull << (36 + (uint32)Char % 28);
+		}
+	}
+	return Mask;
+}
+
+bool FDocumentationFuzzyMatcher::Score(FStringView Key, FStringView LowerKey, FStringView LowerQuery, int32& OutScore)
+{
+	using namespace DocumentationFuzzyMatcher;
+
+	if (LowerQuery.Len() == 0 || LowerQuery.Len() > LowerKey.Len())
+	{
+		return false;
+	}
+
+	// Forward pass: leftmost end of subsequence
+	int32 QueryIndex = 0;
+	int32 End = INDEX_NONE;
+	for (int32 KeyIndex = 0; KeyIndex < LowerKey.Len(); KeyIndex++)
+	{
+		if (LowerKey[KeyIndex] == LowerQuery[QueryIndex] && ++QueryIndex == LowerQuery.Len())
+		{
+			End = KeyIndex;
+			break;
+		}
+	}
+	if (End == INDEX_NONE)
+	{
+		return false;
+	}
+
+	// Backward pass: shortest window that ends there
+	int32 Start = End;
+	QueryIndex = LowerQuery.Len() - 1;
+	for (int32 KeyIndex = End; KeyIndex >= 0; KeyIndex--)
+	{
+		if (LowerKey[KeyIndex] == LowerQuery[QueryIndex])
+		{
+			Start = KeyIndex;
+			if (--QueryIndex < 0)
+			{
+				break;
+			}
+		}
+	}
+
+	// Score matched characters inside the window
+	int32 Score = 0;
+	int32 Consecutive = 0;
+	bool bInGap = false;
+	QueryIndex = 0;
+	for (int32 KeyIndex = Start; KeyIndex <= End; KeyIndex++)
+	{
+		if (QueryIndex < LowerQuery.Len() && LowerKey[KeyIndex] == LowerQuery[QueryIndex])
+		{
+			Score += ScoreMatch + GetPositionBonus(Key, KeyIndex);
+			if (Consecutive > 0)
+			{
+				Score += BonusConsecutive;
+			}
+			Consecutive++;
+			bInGap = false;
+			QueryIndex++;
+		}
+		else
+		{
+			Score -= bInGap ? PenaltyGapExtension : PenaltyGapStart;
+			Consecutive = 0;
+			bInGap = true;
+		}
+	}
+
+	// Prefer matches near the end, where asset and class names are, and shorter keys
+	Score -= (LowerKey.Len() - End - 1) / 4;
+	Score -= LowerKey.Len() / 16;
+
+	OutScore = Score;
+	return true;
+}
+
+void FDocumentationFuzzyMatcher::Query(const FString& QueryText, int32 MaxResults, TArray<FMatch>& OutMatches)
+{
+	OutMatches.Reset();
+
+	const FString LowerQuery = QueryText.ToLower();
+	if (LowerQuery.IsEmpty() || MaxResults <= 0)
+	{
+		LastQuery.Reset();
+		LastCandidates.Reset();
+		return;
+	}
+
+	const uint64 QueryMask = MakeCharMask(LowerQuery);
+
+	TArray<int32> Candidates;
+	TArray<int32> Scores;
+
+	auto TryKey = [&](int32 Index)
+	{
+		if ((Masks[Index] & QueryMask) != QueryMask)
+		{
+			return;
+		}
+
+		int32 KeyScore = 0;
+		if (Score(Keys[Index], LowerKeys[Index], LowerQuery, KeyScore))
+		{
+			Candidates.Add(Index);
+			Scores.Add(KeyScore);
+		}
+	};
+
+	// Key that does not match a prefix of the query cannot match the whole query
+	if (!LastQuery.IsEmpty() && LowerQuery.StartsWith(LastQuery, ESearchCase::CaseSensitive))
+	{
+		Candidates.Reserve(LastCandidates.Num());
+		Scores.Reserve(LastCandidates.Num());
+		for (int32 Index : LastCandidates)
+		{
+			TryKey(Index);
+		}
+	}
+	else
+	{
+		for (int32 Index = 0; Index < Keys.Num(); Index++)
+		{
+			TryKey(Index);
+		}
+	}
+
+	auto IsWorse = [](const FMatch& A, const FMatch& B) { return DocumentationFuzzyMatcher::IsWorse(A, B); };
+
+	// Worst kept match is on top of the heap
+	OutMatches.Reserve(FMath::Min(MaxResults, Candidates.Num()));
+	for (int32 CandidateIndex = 0; CandidateIndex < Candidates.Num(); CandidateIndex++)
+	{
+		const FMatch Match{ Candidates[CandidateIndex], Scores[CandidateIndex] };
+		if (OutMatches.Num() < MaxResults)
+		{
+			OutMatches.HeapPush(Match, IsWorse);
+		}
+		else if (IsWorse(OutMatches.HeapTop(), Match))
+		{
+			OutMatches.HeapPopDiscard(IsWorse, false);
+			OutMatches.HeapPush(Match, IsWorse);
+		}
+	}
+
+	OutMatches.Sort([&IsWorse](const FMatch& A, const FMatch& B) { return IsWorse(B, A); });
+
+	LastQuery = LowerQuery;
+	LastCandidates = MoveTemp(Candidates);
+}
@@ -0,0 +1,49 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Ranked fuzzy subsequence search over fixed set of keys
+ *
+ * Query characters must appear in key in the same order, case insensitive
+ * Matches at word starts, camel case humps and consecutive runs score higher, gaps and long keys score lower
+ *
+ * Each key stores 64-bit mask of its characters, keys missing any query character are rejected with one AND
+ * Typing more characters only rescans keys that matched the previous query
+ */
+class FDocumentationFuzzyMatcher
+{
+public:
+	struct FMatch
+	{
+		int32 Index;
+		int32 Score;
+	};
+
+	void Reset(TArray<FString>&& InKeys);
+
+	int32 Num() const { return Keys.Num(); }
+	const FString& GetKey(int32 Index) const { return Keys[Index]; }
+
+	/** Best matches first. Empty query returns nothing */
+	void Query(const FString& QueryText, int32 MaxResults, TArray<FMatch>& OutMatches);
+
+	/** Bit per letter and digit, remaining characters share upper bits */
+	static uint64 MakeCharMask(FStringView LowerText);
+
+	/** Returns false if query is not subsequence of key. Both lower strings must have the same length as originals */
+	static bool Score(FStringView Key, FStringView LowerKey, FStringView LowerQuery, int32& OutScore);
+
+private:
+	TArray<FString> Keys;
+	TArray<FString> LowerKeys;
+
+	/** Separate array so the prefilter walks contiguous memory */
+	TArray<uint64> Masks;
+
+	FString LastQuery;
+	/** Keys that matched LastQuery */
+	TArray<int32> LastCandidates;
+};
@@ -0,0 +1,685 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "DocumentationSearchIndex.h"
+#include "DocumentationUtilitiesSettings.h"
+#include "DocumentationHintUtils.h"
+#include "DocumentationUtilitiesMemory.h"
+#include "HintStruct.h"
+
+#include <Algo/BinarySearch.h>
+#include <Algo/Unique.h>
+#include <Async/Async.h>
+#include <AssetRegistry/IAssetRegistry.h>
+#include <Engine/Blueprint.h>
+#include <UObject/ObjectSaveContext.h>
+#include <UObject/Package.h>
+#include <UObject/UObjectHash.h>
+#include <UObject/UObjectIterator.h>
+
+
+
+namespace DocumentationSearchIndex
+{
+	/** Seconds per frame spent collecting defaults of types */
+	static constexpr double FrameBudget = 0.002;
+
+	/** Hidden registry tag with hint documents of asset */
+	static const FName HintsTag(TEXT("DocumentationHints"));
+
+	/** Separators of tag value, stripped from texts */
+	static constexpr TCHAR DocumentSeparator = TEXT('\x1E');
+	static constexpr TCHAR FieldSeparator = TEXT('\x1F');
+
+	static FDocumentationSearchDocument MakeHintDocument(const FString& Title, const FProperty* Property, const UStruct* Type, const FHintStruct& Hint)
+	{
+		FDocumentationSearchDocument Document;
+		Document.Title = Title;
+		Document.Text = DocumentationHintUtils::GetHintText(Hint.HintSource, Hint.HintText, Property, Type) + TEXT("\n") + DocumentationHintUtils::GetHintText(Hint.TooltipSource, Hint.TooltipText, Property, Type);
+		Document.Link = Hint.GetLink();
+		return Document;
+	}
+
+	static void AppendTagField(FString& Out, const FString& Field, TCHAR Separator)
+	{
+		for (TCHAR Char : Field)
+		{
+			if (Char != DocumentSeparator && Char != FieldSeparator)
+			{
+				Out.AppendChar(Char);
+			}
+		}
+		Out.AppendChar(Separator);
+	}
+
+	static void ParseTag(const FString& Value, FName Package, TArray<FDocumentationSearchDocument>& OutDocuments)
+	{
+		TArray<FString> Records;
+		Value.ParseIntoArray(Records, TEXT("\x1E"));
+
+		TArray<FString> Fields;
+		for (const FString& Record : Records)
+		{
+			Record.ParseIntoArray(Fields, TEXT("\x1F"), false);
+			if (Fields.Num() == 3)
+			{
+				FDocumentationSearchDocument& Document = OutDocuments.AddDefaulted_GetRef();
+				Document.Title = MoveTemp(Fields[0]);
+				Document.Text = MoveTemp(Fields[1]);
+				Document.Link = MoveTemp(Fields[2]);
+				Document.Package = Package;
+			}
+		}
+	}
+
+	static void IntersectSorted(TArray<int32>& InOut, const TArray<int32>& Other)
+	{
+		int32 Write = 0;
+		int32 OtherIndex = 0;
+		for (int32 Read = 0; Read < InOut.Num(); Read++)
+		{
+			while (OtherIndex < Other.Num() && Other[OtherIndex] < InOut[Read])
+			{
+				OtherIndex++;
+			}
+			if (OtherIndex < Other.Num() && Other[OtherIndex] == InOut[Read])
+			{
+				InOut[Write++] = InOut[Read];
+			}
+		}
+		InOut.SetNum(Write, false);
+	}
+}
+
+
+
+FDocumentationSearchIndex& FDocumentationSearchIndex::Get()
+{
+	static FDocumentationSearchIndex Instance;
+	return Instance;
+}
+
+void FDocumentationSearchIndex::Initialize()
+{
+	if (!PackageSavedHandle.IsValid())
+	{
+		PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FDocumentationSearchIndex::OnPackageSaved);
+	}
+	RequestRebuild();
+}
+
+void FDocumentationSearchIndex::Shutdown()
+{
+	UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+	PackageSavedHandle.Reset();
+
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+
+	if (BuildTask.IsValid())
+	{
+		BuildTask.Wait();
+		BuildTask.Reset();
+	}
+
+	PendingTypes.Empty();
+	NextType = 0;
+	CollectedDocuments.Empty();
+	bCollecting = false;
+
+	Data.Reset();
+	PendingPackages.Reset();
+	bRebuildPending = false;
+
+	UObject::FAssetRegistryTag::OnGetExtraObjectTags.Remove(AssetTagsHandle);
+	AssetTagsHandle.Reset();
+}
+
+void FDocumentationSearchIndex::RegisterAssetTags()
+{
+	if (!AssetTagsHandle.IsValid())
+	{
+		AssetTagsHandle = UObject::FAssetRegistryTag::OnGetExtraObjectTags.AddStatic(&FDocumentationSearchIndex::GetAssetTags);
+	}
+}
+
+int32 FDocumentationSearchIndex::GetNumDocuments() const
+{
+	return Data.IsValid() ? Data->Documents.Num() - Data->NumRemoved : 0;
+}
+
+SIZE_T FDocumentationSearchIndex::GetAllocatedSize() const
+{
+	if (!Data.IsValid())
+	{
+		return 0;
+	}
+
+	SIZE_T Size = sizeof(FIndexData) + Data->Documents.GetAllocatedSize() + Data->Removed.GetAllocatedSize() + Data->Postings.GetAllocatedSize() + Data->SortedTokens.GetAllocatedSize() + Data->PackageDocuments.GetAllocatedSize();
+	for (const FDocumentationSearchDocument& Document : Data->Documents)
+	{
+		Size += Document.Title.GetAllocatedSize() + Document.Text.GetAllocatedSize() + Document.Link.GetAllocatedSize();
+	}
+	for (const TPair<FString, TArray<int32>>& Pair : Data->Postings)
+	{
+		// Keys are shared with SortedTokens by value, count both
+		Size += Pair.Key.GetAllocatedSize() * 2 + Pair.Value.GetAllocatedSize();
+	}
+	for (const TPair<FName, TArray<int32>>& Pair : Data->PackageDocuments)
+	{
+		Size += Pair.Value.GetAllocatedSize();
+	}
+	return Size;
+}
+
+void FDocumentationSearchIndex::RequestRebuild()
+{
+	check(IsInGameThread());
+
+	if (bCollecting || BuildTask.IsValid())
+	{
+		bRebuildPending = true;
+		return;
+	}
+	bRebuildPending = false;
+
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+
+	// Listing types is cheap, creating defaults and walking properties is what gets sliced
+	PendingTypes.Reset();
+	NextType = 0;
+	for (TObjectIterator<UClass> ClassIt; ClassIt; ++ClassIt)
+	{
+		PendingTypes.Add(*ClassIt);
+	}
+	for (TObjectIterator<UScriptStruct> StructIt; StructIt; ++StructIt)
+	{
+		PendingTypes.Add(*StructIt);
+	}
+	CollectedDocuments.Reset();
+	bCollecting = true;
+
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FDocumentationSearchIndex::Tick));
+	}
+}
+
+bool FDocumentationSearchIndex::ProcessTypes(double TimeBudget)
+{
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+
+	const double EndTime = FPlatformTime::Seconds() + TimeBudget;
+	while (NextType < PendingTypes.Num())
+	{
+		// Type may be gone after hot reload or blueprint recompile
+		if (const UStruct* Type = PendingTypes[NextType++].Get())
+		{
+			CollectTypeDocuments(Type, CollectedDocuments);
+		}
+
+		if ((NextType & 63) == 0 && FPlatformTime::Seconds() > EndTime)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FDocumentationSearchIndex::StartBuild()
+{
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+
+	bCollecting = false;
+	PendingTypes.Empty();
+	NextType = 0;
+
+	CollectLinkDocuments(CollectedDocuments);
+
+	BuildTask = Async(EAsyncExecution::ThreadPool, [Documents = MoveTemp(CollectedDocuments)]() mutable
+	{
+		LLM_SCOPE_BYTAG(DocumentationUtilities);
+		CollectAssetDocuments(Documents);
+		return BuildIndex(MoveTemp(Documents));
+	});
+	CollectedDocuments.Reset();
+}
+
+bool FDocumentationSearchIndex::Tick(float DeltaTime)
+{
+	if (bCollecting)
+	{
+		if (ProcessTypes(DocumentationSearchIndex::FrameBudget))
+		{
+			StartBuild();
+		}
+		return true;
+	}
+
+	if (!BuildTask.IsValid() || !BuildTask.IsReady())
+	{
+		return true;
+	}
+
+	Data = BuildTask.Get();
+	BuildTask.Reset();
+
+	for (auto& Pair : PendingPackages)
+	{
+		ApplyPackageUpdate(Pair.Key, MoveTemp(Pair.Value));
+	}
+	PendingPackages.Reset();
+	Data->Compact();
+	Data->SortTokens();
+
+	OnIndexUpdated.Broadcast();
+
+	if (bRebuildPending)
+	{
+		RequestRebuild();
+		return true;
+	}
+
+	TickerHandle.Reset();
+	return false;
+}
+
+void FDocumentationSearchIndex::CollectTypeDocuments(const UStruct* Type, TArray<FDocumentationSearchDocument>& OutDocuments)
+{
+	DocumentationHintUtils::ForEachDefaultHint(Type, [Type, &OutDocuments](const FStructProperty* Property, const FHintStruct& Hint)
+	{
+		FDocumentationSearchDocument& Document = OutDocuments.Add_GetRef(DocumentationSearchIndex::MakeHintDocument(
+			FString::Printf(TEXT("%s.%s"), *Type->GetName(), *Property->GetName()), Property, Type, Hint));
+
+		UPackage* Package = Type->GetOutermost();
+		if (!Package->HasAnyPackageFlags(PKG_CompiledIn))
+		{
+			Document.Package = Package->GetFName();
+		}
+	});
+}
+
+void FDocumentationSearchIndex::CollectLinkDocuments(TArray<FDocumentationSearchDocument>& OutDocuments)
+{
+	check(IsInGameThread());
+
+	const UDocumentationUtilities* Settings = GetDefault<UDocumentationUtilities>();
+	for (const TArray<FDocumentationHintLink>* Source : Settings->GetSources())
+	{
+		for (const FDocumentationHintLink& Link : *Source)
+		{
+			if (Link.HasValue())
+			{
+				FDocumentationSearchDocument& Document = OutDocuments.AddDefaulted_GetRef();
+				Document.Title = Link.GetLinkKey();
+				Document.Text = Link.Value;
+				Document.Link = Document.Title;
+			}
+		}
+	}
+}
+
+void FDocumentationSearchIndex::CollectAssetDocuments(TArray<FDocumentationSearchDocument>& OutDocuments)
+{
+	// Asset registry queries are thread safe, tags and searchable names are read on worker
+	const IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+	if (AssetRegistry == nullptr)
+	{
+		return;
+	}
+
+	TSet<FName> TaggedPackages;
+	{
+		TArray<FAssetData> Assets;
+		AssetRegistry->GetAllAssets(Assets, true);
+
+		FString Value;
+		for (const FAssetData& AssetData : Assets)
+		{
+			if (AssetData.GetTagValue(DocumentationSearchIndex::HintsTag, Value))
+			{
+				DocumentationSearchIndex::ParseTag(Value, AssetData.PackageName, OutDocuments);
+				TaggedPackages.Add(AssetData.PackageName);
+			}
+		}
+	}
+
+	// Packages saved before the tag existed only have link keys until next save
+	DocumentationHintUtils::ForEachAssetHintLink(*AssetRegistry, [&OutDocuments, &TaggedPackages](FName PackageName, const FString& LinkKey)
+	{
+		if (TaggedPackages.Contains(PackageName))
+		{
+			return;
+		}
+
+		FDocumentationSearchDocument& Document = OutDocuments.AddDefaulted_GetRef();
+		Document.Title = FPackageName::GetShortName(PackageName);
+		Document.Text = LinkKey;
+		Document.Link = LinkKey;
+		Document.Package = PackageName;
+	});
+}
+
+void FDocumentationSearchIndex::CollectPackageDocuments(UPackage* Package, TArray<FDocumentationSearchDocument>& OutDocuments)
+{
+	ForEachObjectWithPackage(Package, [&OutDocuments](UObject* Object)
+	{
+		DocumentationHintUtils::ForEachObjectHint(Object, [Object, &OutDocuments](const FProperty* Property, FHintStruct& Hint)
+		{
+			FDocumentationSearchDocument& Document = OutDocuments.Add_GetRef(DocumentationSearchIndex::MakeHintDocument(
+				FString::Printf(TEXT("%s.%s"), *Object->GetName(), *Property->GetName()), Property, Object->GetClass(), Hint));
+			Document.Package = Object->GetOutermost()->GetFName();
+		});
+		return true;
+	});
+}
+
+void FDocumentationSearchIndex::GetAssetTags(const UObject* Object, TArray<UObject::FAssetRegistryTag>& OutTags)
+{
+	if (Object == nullptr || !Object->IsAsset())
+	{
+		return;
+	}
+
+	// Asset, its subobjects and class defaults of blueprint
+	TArray<UObject*> Objects;
+	Objects.Add(const_cast<UObject*>(Object));
+	GetObjectsWithOuter(Object, Objects, true);
+	if (const UBlueprint* Blueprint = Cast<UBlueprint>(Object))
+	{
+		if (Blueprint->GeneratedClass != nullptr)
+		{
+			Objects.Add(Blueprint->GeneratedClass->GetDefaultObject(false));
+		}
+	}
+
+	FString Value;
+	for (UObject* Hinted : Objects)
+	{
+		DocumentationHintUtils::ForEachObjectHint(Hinted, [Hinted, &Value](const FProperty* Property, FHintStruct& Hint)
+		{
+			const FDocumentationSearchDocument Document = DocumentationSearchIndex::MakeHintDocument(
+				FString::Printf(TEXT("%s.%s"), *Hinted->GetName(), *Property->GetName()), Property, Hinted->GetClass(), Hint);
+
+			DocumentationSearchIndex::AppendTagField(Value, Document.Title, DocumentationSearchIndex::FieldSeparator);
+			DocumentationSearchIndex::AppendTagField(Value, Document.Text, DocumentationSearchIndex::FieldSeparator);
+			DocumentationSearchIndex::AppendTagField(Value, Document.Link, DocumentationSearchIndex::DocumentSeparator);
+		});
+	}
+
+	if (!Value.IsEmpty())
+	{
+		OutTags.Emplace(DocumentationSearchIndex::HintsTag, MoveTemp(Value), UObject::FAssetRegistryTag::TT_Hidden);
+	}
+}
+
+FDocumentationSearchIndex::FIndexDataPtr FDocumentationSearchIndex::BuildIndex(TArray<FDocumentationSearchDocument> Documents)
+{
+	FIndexDataPtr Index = MakeShared<FIndexData, ESPMode::ThreadSafe>();
+	Index->Documents.Reserve(Documents.Num());
+
+	for (FDocumentationSearchDocument& Document : Documents)
+	{
+		Index->AddDocument(MoveTemp(Document));
+	}
+	Index->SortTokens();
+	return Index;
+}
+
+void FDocumentationSearchIndex::OnPackageSaved(const FString& PackageFilename, UPackage* Package, FObjectPostSaveContext SaveContext)
+{
+	if (Package == nullptr || SaveContext.IsProceduralSave() || Package->HasAnyFlags(RF_Transient))
+	{
+		return;
+	}
+
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+
+	TArray<FDocumentationSearchDocument> Documents;
+	CollectPackageDocuments(Package, Documents);
+
+	// Documents collected so far may predate this save, apply it after build
+	if (bCollecting || BuildTask.IsValid())
+	{
+		PendingPackages.Add(Package->GetFName(), MoveTemp(Documents));
+	}
+	else if (Data.IsValid())
+	{
+		ApplyPackageUpdate(Package->GetFName(), MoveTemp(Documents));
+		Data->Compact();
+		Data->SortTokens();
+		OnIndexUpdated.Broadcast();
+	}
+}
+
+void FDocumentationSearchIndex::ApplyPackageUpdate(FName Package, TArray<FDocumentationSearchDocument>&& Documents)
+{
+	Data->RemovePackage(Package);
+	for (FDocumentationSearchDocument& Document : Documents)
+	{
+		Data->AddDocument(MoveTemp(Document));
+	}
+}
+
+void FDocumentationSearchIndex::FIndexData::AddDocument(FDocumentationSearchDocument&& Document)
+{
+	TArray<FString> Tokens;
+	Tokenize(Document.Title, Tokens);
+	Tokenize(Document.Text, Tokens);
+	Tokenize(Document.Link, Tokens);
+	Tokens.Sort();
+	Tokens.SetNum(Algo::Unique(Tokens));
+
+	if (!Document.Package.IsNone())
+	{
+		PackageDocuments.FindOrAdd(Document.Package).Add(Documents.Num());
+	}
+	const int32 DocumentIndex = Documents.Add(MoveTemp(Document));
+	Removed.Add(false);
+
+	for (FString& Token : Tokens)
+	{
+		TArray<int32>* Posting = Postings.Find(Token);
+		if (Posting == nullptr)
+		{
+			SortedTokens.Add(Token);
+			Posting = &Postings.Add(MoveTemp(Token));
+		}
+		// Indices only grow, posting stays sorted
+		Posting->Add(DocumentIndex);
+	}
+}
+
+void FDocumentationSearchIndex::FIndexData::SortTokens()
+{
+	SortedTokens.Sort();
+}
+
+void FDocumentationSearchIndex::FIndexData::RemovePackage(FName Package)
+{
+	TArray<int32> PackageIndices;
+	if (Package.IsNone() || !PackageDocuments.RemoveAndCopyValue(Package, PackageIndices))
+	{
+		return;
+	}
+
+	TArray<FString> Tokens;
+	TSet<FString> EmptyTokens;
+	for (int32 DocumentIndex : PackageIndices)
+	{
+		FDocumentationSearchDocument& Document = Documents[DocumentIndex];
+
+		Tokens.Reset();
+		Tokenize(Document.Title, Tokens);
+		Tokenize(Document.Text, Tokens);
+		Tokenize(Document.Link, Tokens);
+		for (const FString& Token : Tokens)
+		{
+			if (TArray<int32>* Posting = Postings.Find(Token))
+			{
+				const int32 Found = Algo::BinarySearch(*Posting, DocumentIndex);
+				if (Found != INDEX_NONE)
+				{
+					Posting->RemoveAt(Found, 1, false);
+				}
+				if (Posting->Num() == 0)
+				{
+					Postings.Remove(Token);
+					EmptyTokens.Add(Token);
+				}
+			}
+		}
+
+		Removed[DocumentIndex] = true;
+		NumRemoved++;
+		Document = FDocumentationSearchDocument();
+	}
+
+	if (EmptyTokens.Num() > 0)
+	{
+		SortedTokens.RemoveAll([&EmptyTokens](const FString& Token) { return EmptyTokens.Contains(Token); });
+	}
+}
+
+void FDocumentationSearchIndex::FIndexData::Compact()
+{
+	if (NumRemoved == 0 || NumRemoved * 2 < Documents.Num())
+	{
+		return;
+	}
+
+	// Remap keeps order, postings stay sorted
+	TArray<int32> Remap;
+	Remap.SetNumUninitialized(Documents.Num());
+	int32 Write = 0;
+	for (int32 Read = 0; Read < Documents.Num(); Read++)
+	{
+		if (Removed[Read])
+		{
+			Remap[Read] = INDEX_NONE;
+			continue;
+		}
+		Remap[Read] = Write;
+		if (Write != Read)
+		{
+			Documents[Write] = MoveTemp(Documents[Read]);
+		}
+		Write++;
+	}
+	Documents.SetNum(Write);
+	Removed.Init(false, Write);
+	NumRemoved = 0;
+
+	for (TPair<FString, TArray<int32>>& Pair : Postings)
+	{
+		for (int32& DocumentIndex : Pair.Value)
+		{
+			DocumentIndex = Remap[DocumentIndex];
+		}
+	}
+	for (TPair<FName, TArray<int32>>& Pair : PackageDocuments)
+	{
+		for (int32& DocumentIndex : Pair.Value)
+		{
+			DocumentIndex = Remap[DocumentIndex];
+		}
+	}
+}
+
+void FDocumentationSearchIndex::Tokenize(FStringView Text, TArray<FString>& OutTokens)
+{
+	int32 TokenStart = INDEX_NONE;
+	for (int32 Index = 0; Index <= Text.Len(); Index++)
+	{
+		const bool bIsWordChar = Index < Text.Len() && FChar::IsAlnum(Text[Index]);
+		if (bIsWordChar && TokenStart == INDEX_NONE)
+		{
+			TokenStart = Index;
+		}
+		else if (!bIsWordChar && TokenStart != INDEX_NONE)
+		{
+			FString Token(Text.Mid(TokenStart, Index - TokenStart));
+			Token.ToLowerInline();
+			OutTokens.Add(MoveTemp(Token));
+			TokenStart = INDEX_NONE;
+		}
+	}
+}
+
+void FDocumentationSearchIndex::Query(const FString& QueryText, int32 MaxResults, TArray<FDocumentationSearchDocument>& OutResults) const
+{
+	OutResults.Reset();
+	if (!Data.IsValid())
+	{
+		return;
+	}
+
+	TArray<FString> Tokens;
+	Tokenize(QueryText, Tokens);
+	if (Tokens.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<int32> Candidates;
+	for (int32 TokenIndex = 0; TokenIndex < Tokens.Num(); TokenIndex++)
+	{
+		const FString& Token = Tokens[TokenIndex];
+
+		TArray<int32> Matches;
+		if (TokenIndex == Tokens.Num() - 1)
+		{
+			// Still typing: any token that starts with the last word
+			for (int32 Index = Algo::LowerBound(Data->SortedTokens, Token); Index < Data->SortedTokens.Num() && Data->SortedTokens[Index].StartsWith(Token, ESearchCase::CaseSensitive); Index++)
+			{
+				Matches.Append(Data->Postings.FindChecked(Data->SortedTokens[Index]));
+			}
+			Matches.Sort();
+			Matches.SetNum(Algo::Unique(Matches));
+		}
+		else if (const TArray<int32>* Posting = Data->Postings.Find(Token))
+		{
+			Matches = *Posting;
+		}
+
+		if (TokenIndex == 0)
+		{
+			Candidates = MoveTemp(Matches);
+		}
+		else
+		{
+			DocumentationSearchIndex::IntersectSorted(Candidates, Matches);
+		}
+
+		if (Candidates.Num() == 0)
+		{
+			return;
+		}
+	}
+
+	// Title matches first, then shorter titles
+	TArray<TPair<int32, int32>> Scored;
+	Scored.Reserve(Candidates.Num());
+	for (int32 DocumentIndex : Candidates)
+	{
+		const FDocumentationSearchDocument& Document = Data->Documents[DocumentIndex];
+
+		int32 Score = -Document.Title.Len();
+		for (const FString& Token : Tokens)
+		{
+			if (Document.Title.Contains(Token))
+			{
+				Score += 1000;
+			}
+		}
+		Scored.Emplace(Score, DocumentIndex);
+	}
+
+	Scored.Sort([](const TPair<int32, int32>& A, const TPair<int32, int32>& B) { return A.Key > B.Key; });
+
+	const int32 NumResults = FMath::Min(MaxResults, Scored.Num());
+	OutResults.Reserve(NumResults);
+	for (int32 Index = 0; Index < NumResults; Index++)
+	{
+		OutResults.Add(Data->Documents[Scored[Index].Value]);
+	}
+}
@@ -0,0 +1,123 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include "UObject/Object.h"
+
+class UPackage;
+class FObjectPostSaveContext;
+
+/** Single searchable entry */
+struct FDocumentationSearchDocument
+{
+	FString Title;
+	FString Text;
+	FString Link;
+
+	/** Owner package of asset documents, used for incremental updates */
+	FName Package;
+};
+
+/**
+ * Inverted index over hint texts, tooltips and links
+ *
+ * Sources: defaults of types in memory, asset registry hint links and settings link tables
+ * Defaults of types are read on game thread over several frames with small time budget,
+ * asset registry links are read and documents tokenized on worker thread, saved packages are reindexed in place
+ * Hint texts of assets are saved as registry tag, so packages are indexed without loading
+ * Game thread only
+ */
+class FDocumentationSearchIndex
+{
+public:
+	static FDocumentationSearchIndex& Get();
+
+	void Initialize();
+	void Shutdown();
+
+	/** Save hint texts of assets as registry tag. Needed before first save, index itself waits for registry */
+	void RegisterAssetTags();
+
+	/** Collect documents over next frames and rebuild index on worker thread */
+	void RequestRebuild();
+
+	bool IsReady() const { return Data.IsValid(); }
+	int32 GetNumDocuments() const;
+
+	/** Heap memory of current index */
+	SIZE_T GetAllocatedSize() const;
+
+	/** All query words must match, last word matches by prefix. Results are ordered by relevance */
+	void Query(const FString& QueryText, int32 MaxResults, TArray<FDocumentationSearchDocument>& OutResults) const;
+
+	DECLARE_MULTICAST_DELEGATE(FOnIndexUpdated);
+	FOnIndexUpdated OnIndexUpdated;
+
+	/** Lowercase alphanumeric words */
+	static void Tokenize(FStringView Text, TArray<FString>& OutTokens);
+
+private:
+	struct FIndexData
+	{
+		TArray<FDocumentationSearchDocument> Documents;
+		TBitArray<> Removed;
+
+		/** Token -> ascending document indices */
+		TMap<FString, TArray<int32>> Postings;
+
+		/** Sorted keys of Postings for prefix search */
+		TArray<FString> SortedTokens;
+
+		/** Package -> its document indices */
+		TMap<FName, TArray<int32>> PackageDocuments;
+
+		int32 NumRemoved = 0;
+
+		/** Appends new tokens to SortedTokens, call SortTokens after batch of documents */
+		void AddDocument(FDocumentationSearchDocument&& Document);
+		void RemovePackage(FName Package);
+		void SortTokens();
+
+		/** Drop removed documents and renumber postings once most of the array is garbage */
+		void Compact();
+	};
+
+	using FIndexDataPtr = TSharedPtr<FIndexData, ESPMode::ThreadSafe>;
+
+	static void CollectTypeDocuments(const UStruct* Type, TArray<FDocumentationSearchDocument>& OutDocuments);
+	static void CollectLinkDocuments(TArray<FDocumentationSearchDocument>& OutDocuments);
+	static void CollectAssetDocuments(TArray<FDocumentationSearchDocument>& OutDocuments);
+	static void CollectPackageDocuments(UPackage* Package, TArray<FDocumentationSearchDocument>& OutDocuments);
+	static FIndexDataPtr BuildIndex(TArray<FDocumentationSearchDocument> Documents);
+
+	static void GetAssetTags(const UObject* Object, TArray<UObject::FAssetRegistryTag>& OutTags);
+
+	/** Returns true when all pending types are collected */
+	bool ProcessTypes(double TimeBudget);
+	void StartBuild();
+
+	void OnPackageSaved(const FString& PackageFilename, UPackage* Package, FObjectPostSaveContext SaveContext);
+	void ApplyPackageUpdate(FName Package, TArray<FDocumentationSearchDocument>&& Documents);
+	bool Tick(float DeltaTime);
+
+	FIndexDataPtr Data;
+	TFuture<FIndexDataPtr> BuildTask;
+
+	/** Types whose defaults are collected before build starts */
+	TArray<TWeakObjectPtr<const UStruct>> PendingTypes;
+	int32 NextType = 0;
+	TArray<FDocumentationSearchDocument> CollectedDocuments;
+	bool bCollecting = false;
+
+	bool bRebuildPending = false;
+
+	/** Saved while full build was running, applied after it finishes */
+	TMap<FName, TArray<FDocumentationSearchDocument>> PendingPackages;
+
+	FDelegateHandle PackageSavedHandle;
+	FDelegateHandle AssetTagsHandle;
+	FTSTicker::FDelegateHandle TickerHandle;
+};
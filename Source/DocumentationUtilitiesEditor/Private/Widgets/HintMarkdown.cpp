@@ -0,0 +1,447 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "HintMarkdown.h"
+#include "DocumentationUtilitiesEditor.h"
+#include "DocumentationUtilitiesSettings.h"
+#include "DocumentationUtilitiesMemory.h"
+
+#include <PropertyCustomizationHelpers.h>
+#include <Styling/SlateStyle.h>
+#include <Framework/Text/SlateHyperlinkRun.h>
+#include <Widgets/Text/SRichTextBlock.h>
+#include <Widgets/SToolTip.h>
+
+
+
+namespace HintMarkdown
+{
+	static const FString BoldRun = TEXT("Bold");
+	static const FString ItalicRun = TEXT("Italic");
+	static const FString CodeRun = TEXT("Code");
+	static const FString HeadingRun = TEXT("Heading");
+	static const FString LinkRun = TEXT("a");
+	static const FString LinkId = TEXT("doclink");
+
+	/** Templated and edited hints produce new strings, keep the cache from growing forever */
+	static constexpr int32 MaxCachedEntries = 4096;
+
+	static bool IsEscapable(TCHAR Char)
+	{
+		return Char == TEXT('\\') || Char == TEXT('*') || Char == TEXT('_') || Char == TEXT('`') || Char == TEXT('[') || Char == TEXT(']') || Char == TEXT('#');
+	}
+
+	/** Position of Delimiter in Text that is not escaped with backslash, INDEX_NONE if there is none */
+	static int32 FindUnescaped(FStringView Text, FStringView Delimiter)
+	{
+		for (int32 Index = 0; Index + Delimiter.Len() <= Text.Len(); Index++)
+		{
+			if (Text[Index] == TEXT('\\') && Index + 1 < Text.Len() && IsEscapable(Text[Index + 1]))
+			{
+				Index++;
+				continue;
+			}
+			if (Text.RightChop(Index).StartsWith(Delimiter))
+			{
+				return Index;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	/** Start and end of line count as whitespace */
+	static TCHAR CharAt(FStringView Text, int32 Index)
+	{
+		return Text.IsValidIndex(Index) ? Text[Index] : TEXT(' ');
+	}
+
+	/** CommonMark delimiter run rules: asterisk may be intraword, underscore only at word boundaries so snake_case stays plain */
+	static bool IsLeftFlanking(FStringView Text, int32 Start, int32 Len)
+	{
+		const TCHAR Prev = CharAt(Text, Start - 1);
+		const TCHAR Next = CharAt(Text, Start + Len);
+		return !FChar::IsWhitespace(Next) && (!FChar::IsPunct(Next) || FChar::IsWhitespace(Prev) || FChar::IsPunct(Prev));
+	}
+
+	static bool IsRightFlanking(FStringView Text, int32 Start, int32 Len)
+	{
+		const TCHAR Prev = CharAt(Text, Start - 1);
+		const TCHAR Next = CharAt(Text, Start + Len);
+		return !FChar::IsWhitespace(Prev) && (!FChar::IsPunct(Prev) || FChar::IsWhitespace(Next) || FChar::IsPunct(Next));
+	}
+
+	static bool CanOpen(FStringView Text, int32 Start, int32 Len)
+	{
+		const bool bLeft = IsLeftFlanking(Text, Start, Len);
+		if (Text[Start] == TEXT('_'))
+		{
+			// Underscore never opens inside a word
+			return bLeft && (!IsRightFlanking(Text, Start, Len) || FChar::IsPunct(CharAt(Text, Start - 1)));
+		}
+		return bLeft;
+	}
+
+	static bool CanClose(FStringView Text, int32 Start, int32 Len)
+	{
+		const bool bRight = IsRightFlanking(Text, Start, Len);
+		if (Text[Start] == TEXT('_'))
+		{
+			return bRight && (!IsLeftFlanking(Text, Start, Len) || FChar::IsPunct(CharAt(Text, Start + Len)));
+		}
+		return bRight;
+	}
+
+	/** Position in Text of first unescaped Delimiter after From that can close emphasis, INDEX_NONE if there is none */
+	static int32 FindCloser(FStringView Text, int32 From, FStringView Delimiter)
+	{
+		int32 Position = From;
+		while (Position < Text.Len())
+		{
+			const int32 Found = FindUnescaped(Text.RightChop(Position), Delimiter);
+			if (Found == INDEX_NONE)
+			{
+				return INDEX_NONE;
+			}
+			if (CanClose(Text, Position + Found, Delimiter.Len()))
+			{
+				return Position + Found;
+			}
+			Position += Found + 1;
+		}
+		return INDEX_NONE;
+	}
+
+	static void AppendUnescaped(FStringView Text, FString& Out)
+	{
+		for (int32 Index = 0; Index < Text.Len(); Index++)
+		{
+			if (Text[Index] == TEXT('\\') && Index + 1 < Text.Len() && IsEscapable(Text[Index + 1]))
+			{
+				Index++;
+			}
+			Out.AppendChar(Text[Index]);
+		}
+	}
+
+	static void OnLinkClicked(const FSlateHyperlinkRun::FMetadata& Metadata)
+	{
+		if (const FString* Href = Metadata.Find(TEXT("href")))
+		{
+			IDocumentationUtilitiesEditorModule::OpenLink(*Href);
+		}
+	}
+
+	static TSharedRef<SRichTextBlock> MakeRichText(const TAttribute<FText>& Text)
+	{
+		const ISlateStyle& Style = FHintMarkdownParser::GetStyle();
+
+		return SNew(SRichTextBlock)
+			.Text(Text)
+			.AutoWrapText(true)
+			.TextStyle(&Style.GetWidgetStyle<FTextBlockStyle>("Normal"))
+			.DecoratorStyleSet(&Style)
+			.Parser(FHintMarkdownParser::Get())
+			+ SRichTextBlock::HyperlinkDecorator(LinkId, FSlateHyperlinkRun::FOnClick::CreateStatic(&OnLinkClicked));
+	}
+}
+
+
+
+TSharedRef<FHintMarkdownParser> FHintMarkdownParser::Get()
+{
+	static TSharedRef<FHintMarkdownParser> Instance = MakeShareable(new FHintMarkdownParser());
+	return Instance;
+}
+
+const ISlateStyle& FHintMarkdownParser::GetStyle()
+{
+	static TSharedPtr<FSlateStyleSet> StyleSet;
+	if (!StyleSet.IsValid())
+	{
+		StyleSet = MakeShared<FSlateStyleSet>("DocumentationUtilities.HintMarkdown");
+
+		const FTextBlockStyle NormalText = FTextBlockStyle(FAppStyle::GetWidgetStyle<FTextBlockStyle>("NormalText"))
+			.SetFont(IPropertyTypeCustomizationUtils::GetRegularFont());
+
+		StyleSet->Set("Normal", NormalText);
+		StyleSet->Set(*HintMarkdown::BoldRun, FTextBlockStyle(NormalText).SetFont(IPropertyTypeCustomizationUtils::GetBoldFont()));
+		StyleSet->Set(*HintMarkdown::ItalicRun, FTextBlockStyle(NormalText).SetFont(FCoreStyle::GetDefaultFontStyle("Italic", NormalText.Font.Size)));
+		StyleSet->Set(*HintMarkdown::CodeRun, FTextBlockStyle(NormalText).SetFont(FCoreStyle::GetDefaultFontStyle("Mono", NormalText.Font.Size)));
+		StyleSet->Set(*HintMarkdown::HeadingRun, FTextBlockStyle(NormalText).SetFont(FCoreStyle::GetDefaultFontStyle("Bold", NormalText.Font.Size + 2)));
+
+		FHyperlinkStyle HyperlinkStyle = FCoreStyle::Get().GetWidgetStyle<FHyperlinkStyle>("Hyperlink");
+		HyperlinkStyle.TextStyle.SetFont(NormalText.Font);
+		StyleSet->Set("Hyperlink", HyperlinkStyle);
+	}
+	return *StyleSet;
+}
+
+TSharedRef<SWidget> FHintMarkdownParser::MakeHintWidget(const TAttribute<FText>& Text, const TAttribute<FText>& ToolTipText)
+{
+	const UDocumentationUtilities* Settings = GetDefault<UDocumentationUtilities>();
+	if (!Settings->bMarkdownHints)
+	{
+		return SNew(STextBlock)
+			.Font(IPropertyTypeCustomizationUtils::GetRegularFont())
+			.AutoWrapText(true)
+			.Text(Text)
+			.ToolTipText(ToolTipText);
+	}
+
+	TSharedRef<SRichTextBlock> Widget = HintMarkdown::MakeRichText(Text);
+	if (ToolTipText.IsBound() || !ToolTipText.Get().IsEmpty())
+	{
+		Widget->SetToolTip(SNew(SToolTip)[ HintMarkdown::MakeRichText(ToolTipText) ]);
+	}
+	return Widget;
+}
+
+void FHintMarkdownParser::AppendEscaped(FStringView Text, FString& Out)
+{
+	for (TCHAR Char : Text)
+	{
+		if (HintMarkdown::IsEscapable(Char))
+		{
+			Out.AppendChar(TEXT('\\'));
+		}
+		Out.AppendChar(Char);
+	}
+}
+
+void FHintMarkdownParser::Process(TArray<FTextLineParseResults>& Results, const FString& Input, FString& Output)
+{
+	TSharedRef<const FParsedMarkup> Markup = FindOrParse(Input);
+	Results = Markup->Lines;
+	Output = Markup->Output;
+}
+
+TMap<FString, TSharedRef<const FHintMarkdownParser::FParsedMarkup>>& FHintMarkdownParser::GetCache()
+{
+	static TMap<FString, TSharedRef<const FParsedMarkup>> Cache;
+	return Cache;
+}
+
+void FHintMarkdownParser::ClearCache()
+{
+	GetCache().Reset();
+}
+
+SIZE_T FHintMarkdownParser::GetCacheAllocatedSize(int32& OutNumEntries)
+{
+	const TMap<FString, TSharedRef<const FParsedMarkup>>& Cache = GetCache();
+	OutNumEntries = Cache.Num();
+
+	SIZE_T Size = Cache.GetAllocatedSize();
+	for (const auto& Pair : Cache)
+	{
+		const FParsedMarkup& Markup = Pair.Value.Get();
+		Size += Pair.Key.GetAllocatedSize() + sizeof(FParsedMarkup) + Markup.Output.GetAllocatedSize() + Markup.Lines.GetAllocatedSize();
+		for (const FTextLineParseResults& Line : Markup.Lines)
+		{
+			Size += Line.Runs.GetAllocatedSize();
+			for (const FTextRunParseResults& Run : Line.Runs)
+			{
+				Size += Run.Name.GetAllocatedSize() + Run.MetaData.GetAllocatedSize();
+			}
+		}
+	}
+	return Size;
+}
+
+TSharedRef<const FHintMarkdownParser::FParsedMarkup> FHintMarkdownParser::FindOrParse(const FString& Input)
+{
+	check(IsInGameThread());
+
+	TMap<FString, TSharedRef<const FParsedMarkup>>& Cache = GetCache();
+	if (const TSharedRef<const FParsedMarkup>* Cached = Cache.Find(Input))
+	{
+		return *Cached;
+	}
+
+	LLM_SCOPE_BYTAG(DocumentationUtilities);
+
+	if (Cache.Num() >= HintMarkdown::MaxCachedEntries)
+	{
+		Cache.Reset();
+	}
+
+	TSharedRef<FParsedMarkup> Markup = MakeShared<FParsedMarkup>();
+	TArray<FPendingMetaData> PendingMetaData;
+
+	FStringView Remaining = Input;
+	while (true)
+	{
+		int32 LineEnd = INDEX_NONE;
+		const bool bHasMoreLines = Remaining.FindChar(TEXT('\n'), LineEnd);
+
+		FStringView Line = bHasMoreLines ? Remaining.Left(LineEnd) : Remaining;
+		Line.RemoveSuffix(Line.EndsWith(TEXT('\r')) ? 1 : 0);
+
+		if (Markup->Lines.Num() > 0)
+		{
+			Markup->Output.AppendChar(TEXT('\n'));
+		}
+		ParseLine(Line, *Markup, PendingMetaData);
+
+		if (!bHasMoreLines)
+		{
+			break;
+		}
+		Remaining.RightChopInline(LineEnd + 1);
+	}
+
+	for (const FPendingMetaData& MetaData : PendingMetaData)
+	{
+		Markup->Output.AppendChar(TEXT('\n'));
+		const int32 Start = Markup->Output.Len();
+		Markup->Output.Append(MetaData.Value);
+		Markup->Lines[MetaData.LineIndex].Runs[MetaData.RunIndex].MetaData.Add(MetaData.Key, FTextRange(Start, Markup->Output.Len()));
+	}
+
+	Cache.Add(Input, Markup);
+	return Markup;
+}
+
+void FHintMarkdownParser::ParseLine(FStringView Line, FParsedMarkup& Markup, TArray<FPendingMetaData>& PendingMetaData)
+{
+	FString& Output = Markup.Output;
+
+	FTextLineParseResults LineResults;
+	const int32 LineStart = Output.Len();
+
+	const FStringView Content = Line.TrimStart();
+	const int32 Indent = Line.Len() - Content.Len();
+
+	int32 HeadingLevel = 0;
+	while (HeadingLevel < Content.Len() && Content[HeadingLevel] == TEXT('#'))
+	{
+		HeadingLevel++;
+	}
+
+	if (HeadingLevel > 0 && HeadingLevel < Content.Len() && Content[HeadingLevel] == TEXT(' '))
+	{
+		const FStringView Heading = Content.RightChop(HeadingLevel).TrimStartAndEnd();
+		HintMarkdown::AppendUnescaped(Heading, Output);
+
+		const FTextRange Range(LineStart, Output.Len());
+		LineResults.Runs.Emplace(HintMarkdown::HeadingRun, Range, Range);
+	}
+	else if (Content.StartsWith(TEXT("- ")) || Content.StartsWith(TEXT("* ")) || Content.StartsWith(TEXT("+ ")))
+	{
+		for (int32 Index = 0; Index < Indent; Index++)
+		{
+			Output.AppendChar(TEXT(' '));
+		}
+		Output.Append(TEXT("\u2022 "));
+
+		ParseInline(Content.RightChop(2), LineStart, Markup, LineResults, PendingMetaData);
+	}
+	else
+	{
+		ParseInline(Line, LineStart, Markup, LineResults, PendingMetaData);
+	}
+
+	if (LineResults.Runs.Num() == 0)
+	{
+		// Keep empty lines as paragraph separators
+		const FTextRange Range(LineStart, Output.Len());
+		LineResults.Runs.Emplace(FString(), Range, Range);
+	}
+
+	LineResults.Range = FTextRange(LineStart, Output.Len());
+	Markup.Lines.Add(MoveTemp(LineResults));
+}
+
+void FHintMarkdownParser::ParseInline(FStringView Text, int32 PlainStart, FParsedMarkup& Markup, FTextLineParseResults& LineResults, TArray<FPendingMetaData>& PendingMetaData)
+{
+	FString& Output = Markup.Output;
+	TArray<FTextRunParseResults>& Runs = LineResults.Runs;
+
+	auto FlushPlain = [&]()
+	{
+		if (Output.Len() > PlainStart)
+		{
+			const FTextRange Range(PlainStart, Output.Len());
+			Runs.Emplace(FString(), Range, Range);
+		}
+	};
+
+	auto AddRun = [&](const FString& Name, FStringView Content) -> int32
+	{
+		FlushPlain();
+
+		const int32 Start = Output.Len();
+		HintMarkdown::AppendUnescaped(Content, Output);
+		PlainStart = Output.Len();
+
+		const FTextRange Range(Start, Output.Len());
+		return Runs.Emplace(Name, Range, Range);
+	};
+
+	int32 Index = 0;
+	while (Index < Text.Len())
+	{
+		const TCHAR Char = Text[Index];
+		const FStringView Rest = Text.RightChop(Index);
+
+		if (Char == TEXT('\\') && Rest.Len() > 1 && HintMarkdown::IsEscapable(Rest[1]))
+		{
+			Output.AppendChar(Rest[1]);
+			Index += 2;
+			continue;
+		}
+
+		if (Rest.StartsWith(TEXT("**")))
+		{
+			const int32 Close = HintMarkdown::CanOpen(Text, Index, 2) ? HintMarkdown::FindCloser(Text, Index + 2, TEXT("**")) : INDEX_NONE;
+			if (Close > Index + 2)
+			{
+				AddRun(HintMarkdown::BoldRun, Text.Mid(Index + 2, Close - Index - 2));
+				Index = Close + 2;
+				continue;
+			}
+		}
+		else if (Char == TEXT('`'))
+		{
+			const int32 Close = HintMarkdown::FindUnescaped(Rest.RightChop(1), Rest.Left(1));
+			if (Close > 0)
+			{
+				AddRun(HintMarkdown::CodeRun, Rest.Mid(1, Close));
+				Index += Close + 2;
+				continue;
+			}
+		}
+		else if (Char == TEXT('*') || Char == TEXT('_'))
+		{
+			const int32 Close = HintMarkdown::CanOpen(Text, Index, 1) ? HintMarkdown::FindCloser(Text, Index + 1, Rest.Left(1)) : INDEX_NONE;
+			if (Close > Index + 1)
+			{
+				AddRun(HintMarkdown::ItalicRun, Text.Mid(Index + 1, Close - Index - 1));
+				Index = Close + 1;
+				continue;
+			}
+		}
+		else if (Char == TEXT('['))
+		{
+			const int32 LabelEnd = HintMarkdown::FindUnescaped(Rest, TEXT("]"));
+			int32 AddressEnd = INDEX_NONE;
+			if (LabelEnd > 1 &&
+				Rest.Len() > LabelEnd + 1 && Rest[LabelEnd + 1] == TEXT('(') &&
+				Rest.RightChop(LabelEnd + 2).FindChar(TEXT(')'), AddressEnd) && AddressEnd > 0)
+			{
+				const int32 RunIndex = AddRun(HintMarkdown::LinkRun, Rest.Mid(1, LabelEnd - 1));
+				const int32 LineIndex = Markup.Lines.Num();
+
+				PendingMetaData.Add({ LineIndex, RunIndex, TEXT("id"), HintMarkdown::LinkId });
+				PendingMetaData.Add({ LineIndex, RunIndex, TEXT("href"), FString(Rest.Mid(LabelEnd + 2, AddressEnd)) });
+
+				Index += LabelEnd + 2 + AddressEnd + 1;
+				continue;
+			}
+		}
+
+		Output.AppendChar(Char);
+		Index++;
+	}
+
+	FlushPlain();
+}
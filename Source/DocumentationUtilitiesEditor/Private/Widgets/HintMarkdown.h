@@ -0,0 +1,62 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Framework/Text/IRichTextMarkupParser.h"
+
+class SWidget;
+class ISlateStyle;
+
+/**
+ * Converts Markdown subset into rich text runs
+ *
+ * Supported: **bold**, *italic* or _italic_, `code`, [text](link), # heading, - list, * list, backslash escapes
+ * Link can be anything accepted by OpenLink, including link keys
+ *
+ * Every distinct string is parsed once, results are shared by all widgets that display it
+ */
+class FHintMarkdownParser : public IRichTextMarkupParser
+{
+public:
+	static TSharedRef<FHintMarkdownParser> Get();
+
+	//~ Begin IRichTextMarkupParser Interface
+	virtual void Process(TArray<FTextLineParseResults>& Results, const FString& Input, FString& Output) override;
+	//~ End IRichTextMarkupParser Interface
+
+	/** Style set with text styles used by parsed runs */
+	static const ISlateStyle& GetStyle();
+
+	/** Create text widget for hint. Falls back to plain text when markdown is disabled in settings */
+	static TSharedRef<SWidget> MakeHintWidget(const TAttribute<FText>& Text, const TAttribute<FText>& ToolTipText);
+
+	/** Append Text with markup characters escaped, so it is displayed as written */
+	static void AppendEscaped(FStringView Text, FString& Out);
+
+	static void ClearCache();
+
+	/** Heap memory of cached parse results */
+	static SIZE_T GetCacheAllocatedSize(int32& OutNumEntries);
+
+private:
+	struct FParsedMarkup
+	{
+		TArray<FTextLineParseResults> Lines;
+		FString Output;
+	};
+
+	/** Metadata values are stored after the last line, out of displayed ranges */
+	struct FPendingMetaData
+	{
+		int32 LineIndex;
+		int32 RunIndex;
+		FString Key;
+		FString Value;
+	};
+
+	static TMap<FString, TSharedRef<const FParsedMarkup>>& GetCache();
+	static TSharedRef<const FParsedMarkup> FindOrParse(const FString& Input);
+	static void ParseLine(FStringView Line, FParsedMarkup& Markup, TArray<FPendingMetaData>& PendingMetaData);
+	static void ParseInline(FStringView Text, int32 PlainStart, FParsedMarkup& Markup, FTextLineParseResults& LineResults, TArray<FPendingMetaData>& PendingMetaData);
+};
@@ -0,0 +1,238 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "SDocumentationLinkGC.h"
+#include "HintStruct.h"
+#include "DocumentationLinkSnapshot.h"
+
+#include <Widgets/Input/SButton.h>
+#include <Widgets/Layout/SSplitter.h>
+#include <Widgets/Text/STextBlock.h>
+
+#include <AssetRegistry/AssetIdentifier.h>
+#include <Editor.h>
+#include <Misc/MessageDialog.h>
+
+
+
+#define LOCTEXT_NAMESPACE "DocumentationUtilities"
+
+const FName SDocumentationLinkGC::TabName = TEXT("DocumentationLinkGC");
+
+SDocumentationLinkGC::~SDocumentationLinkGC()
+{
+	FDocumentationLinkGC::Get().OnReportReady.RemoveAll(this);
+}
+
+void SDocumentationLinkGC::Construct(const FArguments& InArgs)
+{
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(4.f)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text(this, &SDocumentationLinkGC::GetStatusText)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("LinkGC_Scan", "Scan"))
+				.IsEnabled_Lambda([]() { return !FDocumentationLinkGC::Get().IsRunning(); })
+				.OnClicked_Lambda([]()
+				{
+					FDocumentationLinkGC::Get().Start();
+					return FReply::Handled();
+				})
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(4.f, 0.f, 0.f, 0.f)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("LinkGC_Prune", "Prune Unused"))
+				.ToolTipText(LOCTEXT("LinkGC_PruneTooltip", "Remove unused Asset and Class entries from Links in one undoable transaction. Requires complete scan of current settings"))
+				.IsEnabled_Lambda([]() { return FDocumentationLinkGC::Get().CanPrune(); })
+				.OnClicked(this, &SDocumentationLinkGC::OnPruneClicked)
+			]
+		]
+		+ SVerticalBox::Slot()
+		.FillHeight(1.f)
+		[
+			SNew(SSplitter)
+			.Orientation(Orient_Vertical)
+			+ SSplitter::Slot()
+			[
+				SAssignNew(UnusedView, SListView<FUnusedPtr>)
+				.ListItemsSource(&UnusedKeys)
+				.SelectionMode(ESelectionMode::Single)
+				.OnGenerateRow(this, &SDocumentationLinkGC::OnGenerateUnusedRow)
+				.HeaderRow
+				(
+					SNew(SHeaderRow)
+					+ SHeaderRow::Column(TEXT("Key"))
+					.DefaultLabel(LOCTEXT("LinkGC_Unused", "Unused Links"))
+				)
+			]
+			+ SSplitter::Slot()
+			[
+				SAssignNew(UnreferencedStringView, SListView<FUnusedPtr>)
+				.ListItemsSource(&UnreferencedStringKeys)
+				.SelectionMode(ESelectionMode::Single)
+				.OnGenerateRow(this, &SDocumentationLinkGC::OnGenerateUnusedRow)
+				.HeaderRow
+				(
+					SNew(SHeaderRow)
+					+ SHeaderRow::Column(TEXT("Key"))
+					.DefaultLabel(LOCTEXT("LinkGC_UnreferencedString", "Unreferenced String Links (not pruned, may be used by hint text or code)"))
+				)
+			]
+			+ SSplitter::Slot()
+			[
+				SAssignNew(DanglingView, SListView<FDanglingPtr>)
+				.ListItemsSource(&DanglingKeys)
+				.SelectionMode(ESelectionMode::Single)
+				.OnGenerateRow(this, &SDocumentationLinkGC::OnGenerateDanglingRow)
+				.OnMouseButtonDoubleClick(this, &SDocumentationLinkGC::OnDanglingDoubleClicked)
+				.HeaderRow
+				(
+					SNew(SHeaderRow)
+					+ SHeaderRow::Column(TEXT("Key"))
+					.DefaultLabel(LOCTEXT("LinkGC_Dangling", "Keys Without Value"))
+				)
+			]
+		]
+	];
+
+	FDocumentationLinkGC::Get().OnReportReady.AddSP(this, &SDocumentationLinkGC::OnReportReady);
+	OnReportReady();
+
+	if (!FDocumentationLinkGC::Get().GetReport().IsValid())
+	{
+		FDocumentationLinkGC::Get().Start();
+	}
+}
+
+void SDocumentationLinkGC::OnReportReady()
+{
+	UnusedKeys.Reset();
+	UnreferencedStringKeys.Reset();
+	DanglingKeys.Reset();
+
+	if (FDocumentationLinkGC::FReportPtr Report = FDocumentationLinkGC::Get().GetReport())
+	{
+		for (const FString& Key : Report->UnusedKeys)
+		{
+			UnusedKeys.Add(MakeShared<FString>(Key));
+		}
+		for (const FString& Key : Report->UnreferencedStringKeys)
+		{
+			UnreferencedStringKeys.Add(MakeShared<FString>(Key));
+		}
+		for (const FDocumentationLinkGCReport::FDanglingKey& Key : Report->DanglingKeys)
+		{
+			DanglingKeys.Add(MakeShared<FDocumentationLinkGCReport::FDanglingKey>(Key));
+		}
+	}
+
+	UnusedView->RequestListRefresh();
+	UnreferencedStringView->RequestListRefresh();
+	DanglingView->RequestListRefresh();
+}
+
+TSharedRef<ITableRow> SDocumentationLinkGC::OnGenerateUnusedRow(FUnusedPtr Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(STableRow<FUnusedPtr>, OwnerTable)
+		[
+			SNew(STextBlock).Text(FText::FromString(*Item))
+		];
+}
+
+TSharedRef<ITableRow> SDocumentationLinkGC::OnGenerateDanglingRow(FDanglingPtr Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	const FText Source = Item->Referencer.IsNone()
+		? LOCTEXT("LinkGC_NativeSource", "Native")
+		: Item->NumReferencers > 1
+			? FText::Format(LOCTEXT("LinkGC_PackageSourceMore", "{0} and {1} more"), FText::FromName(Item->Referencer), FText::AsNumber(Item->NumReferencers - 1))
+			: FText::FromName(Item->Referencer);
+
+	return SNew(STableRow<FDanglingPtr>, OwnerTable)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.FillWidth(0.5f)
+			[
+				SNew(STextBlock).Text(FText::FromString(Item->Key))
+			]
+			+ SHorizontalBox::Slot()
+			.FillWidth(0.5f)
+			[
+				SNew(STextBlock)
+				.Text(Source)
+				.ColorAndOpacity(FSlateColor::UseSubduedForeground())
+			]
+		];
+}
+
+void SDocumentationLinkGC::OnDanglingDoubleClicked(FDanglingPtr Item)
+{
+	if (Item.IsValid())
+	{
+		TArray<FAssetIdentifier> AssetIdentifiers;
+		AssetIdentifiers.Add(FAssetIdentifier(FHintStruct::StaticStruct(), *Item->Key));
+		FEditorDelegates::OnOpenReferenceViewer.Broadcast(AssetIdentifiers, FReferenceViewerParams());
+	}
+}
+
+FReply SDocumentationLinkGC::OnPruneClicked()
+{
+	const FText Message = FText::Format(LOCTEXT("LinkGC_PruneConfirm", "Remove {0} unused link(s) from settings?"), FText::AsNumber(UnusedKeys.Num()));
+	if (FMessageDialog::Open(EAppMsgType::YesNo, Message) == EAppReturnType::Yes)
+	{
+		FDocumentationLinkGC::Get().PruneUnused();
+	}
+	return FReply::Handled();
+}
+
+FText SDocumentationLinkGC::GetStatusText() const
+{
+	const FDocumentationLinkGC& GC = FDocumentationLinkGC::Get();
+	if (GC.IsRunning())
+	{
+		return LOCTEXT("LinkGC_Scanning", "Scanning...");
+	}
+
+	FDocumentationLinkGC::FReportPtr Report = GC.GetReport();
+	if (!Report.IsValid())
+	{
+		return FText::GetEmpty();
+	}
+
+	FText Status = FText::Format(LOCTEXT("LinkGC_Status", "{0} unused, {1} unreferenced string, {2} without value, {3} packages scanned in {4}s"),
+		FText::AsNumber(Report->UnusedKeys.Num()),
+		FText::AsNumber(Report->UnreferencedStringKeys.Num()),
+		FText::AsNumber(Report->DanglingKeys.Num()),
+		FText::AsNumber(Report->NumScannedPackages),
+		FText::AsNumber(Report->Seconds));
+
+	if (Report->bIncomplete)
+	{
+		return FText::Format(LOCTEXT("LinkGC_Incomplete", "{0}. Asset registry was still loading, scan again when it finishes"), Status);
+	}
+
+	FDocumentationLinkReadScope Snapshot;
+	if (Snapshot->GetSerial() != Report->SnapshotSerial)
+	{
+		return FText::Format(LOCTEXT("LinkGC_Stale", "{0}. Links changed since scan, scan again to prune"), Status);
+	}
+	return Status;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,46 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "DocumentationLinkGC.h"
+
+/**
+ * Report of unused entries of Links and hint keys without value
+ * Unused Asset and Class entries can be removed together, String entries are only listed for manual review
+ * Dangling keys open reference viewer on double click
+ */
+class SDocumentationLinkGC : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SDocumentationLinkGC) {}
+	SLATE_END_ARGS()
+
+	static const FName TabName;
+
+	virtual ~SDocumentationLinkGC() override;
+
+	void Construct(const FArguments& InArgs);
+
+private:
+	using FUnusedPtr = TSharedPtr<FString>;
+	using FDanglingPtr = TSharedPtr<FDocumentationLinkGCReport::FDanglingKey>;
+
+	void OnReportReady();
+
+	TSharedRef<ITableRow> OnGenerateUnusedRow(FUnusedPtr Item, const TSharedRef<STableViewBase>& OwnerTable);
+	TSharedRef<ITableRow> OnGenerateDanglingRow(FDanglingPtr Item, const TSharedRef<STableViewBase>& OwnerTable);
+	void OnDanglingDoubleClicked(FDanglingPtr Item);
+
+	FReply OnPruneClicked();
+	FText GetStatusText() const;
+
+	TArray<FUnusedPtr> UnusedKeys;
+	TArray<FUnusedPtr> UnreferencedStringKeys;
+	TArray<FDanglingPtr> DanglingKeys;
+	TSharedPtr<SListView<FUnusedPtr>> UnusedView;
+	TSharedPtr<SListView<FUnusedPtr>> UnreferencedStringView;
+	TSharedPtr<SListView<FDanglingPtr>> DanglingView;
+};
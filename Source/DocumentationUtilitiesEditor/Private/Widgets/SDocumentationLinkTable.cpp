@@ -0,0 +1,623 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "SDocumentationLinkTable.h"
+#include "DocumentationUtilitiesSettings.h"
+#include "DocumentationLinkSnapshot.h"
+#include "HintStruct.h"
+
+#include <ClassViewerModule.h>
+#include <ClassViewerFilter.h>
+#include <PropertyCustomizationHelpers.h>
+#include <Framework/MultiBox/MultiBoxBuilder.h>
+#include <Widgets/Input/SButton.h>
+#include <Widgets/Input/SComboButton.h>
+#include <Widgets/Input/SEditableTextBox.h>
+#include <Widgets/Input/SSearchBox.h>
+#include <Widgets/Text/STextBlock.h>
+
+#include <AssetRegistry/AssetIdentifier.h>
+#include <Editor.h>
+#include <HAL/PlatformApplicationMisc.h>
+#include <ScopedTransaction.h>
+
+
+
+#define LOCTEXT_NAMESPACE "DocumentationUtilities"
+
+namespace DocumentationLinkTableColumns
+{
+	static const FName Source = TEXT("Source");
+	static const FName Type = TEXT("Type");
+	static const FName Key = TEXT("Key");
+	static const FName Value = TEXT("Value");
+}
+
+namespace DocumentationLinkTable
+{
+	static FText GetTypeText(EDocumentationLinkType Type)
+	{
+		return StaticEnum<EDocumentationLinkType>()->GetDisplayNameTextByValue(static_cast<int64>(Type));
+	}
+}
+
+FDocumentationHintLink* FDocumentationLinkTableItem::Get() const
+{
+	return Source && Source->IsValidIndex(Index) ? &(*Source)[Index] : nullptr;
+}
+
+class SDocumentationLinkTableRow : public SMultiColumnTableRow<SDocumentationLinkTable::FItemPtr>
+{
+public:
+	SLATE_BEGIN_ARGS(SDocumentationLinkTableRow) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& OwnerTable, SDocumentationLinkTable::FItemPtr InItem, TSharedRef<SDocumentationLinkTable> InTable)
+	{
+		Item = InItem;
+		Table = InTable;
+		SMultiColumnTableRow<SDocumentationLinkTable::FItemPtr>::Construct(FSuperRowType::FArguments(), OwnerTable);
+	}
+
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override
+	{
+		TSharedRef<SWidget> Content = SNullWidget::NullWidget;
+		if (ColumnName == DocumentationLinkTableColumns::Source)
+		{
+			Content = SNew(STextBlock)
+				.Text(Item->SourceName)
+				.ColorAndOpacity(FSlateColor::UseSubduedForeground());
+		}
+		else if (ColumnName == DocumentationLinkTableColumns::Type)
+		{
+			Content = MakeTypeWidget();
+		}
+		else if (ColumnName == DocumentationLinkTableColumns::Key)
+		{
+			Content = MakeKeyWidget();
+		}
+		else if (ColumnName == DocumentationLinkTableColumns::Value)
+		{
+			Content = SNew(SEditableTextBox)
+				.Text_Lambda([Item = Item]() { return FText::FromString(Item->Value); })
+				.IsReadOnly(Item->bReadOnly)
+				.OnTextCommitted(this, &SDocumentationLinkTableRow::OnValueCommitted);
+		}
+
+		return SNew(SBox)
+			.VAlign(VAlign_Center)
+			.Padding(2.f, 1.f)
+			[
+				Content
+			];
+	}
+
+private:
+	TSharedRef<SWidget> MakeTypeWidget()
+	{
+		if (!Item->bUserEntry)
+		{
+			return SNew(STextBlock).Text(DocumentationLinkTable::GetTypeText(Item->Type));
+		}
+
+		// Menu is built on open, closed combo is just a label
+		return SNew(SComboButton)
+			.OnGetMenuContent(this, &SDocumentationLinkTableRow::MakeTypeMenu)
+			.ButtonContent()
+			[
+				SNew(STextBlock).Text(DocumentationLinkTable::GetTypeText(Item->Type))
+			];
+	}
+
+	TSharedRef<SWidget> MakeTypeMenu()
+	{
+		FMenuBuilder MenuBuilder(true, nullptr);
+		for (EDocumentationLinkType Type : { EDocumentationLinkType::String, EDocumentationLinkType::Asset, EDocumentationLinkType::Class })
+		{
+			MenuBuilder.AddMenuEntry(
+				DocumentationLinkTable::GetTypeText(Type),
+				FText::GetEmpty(),
+				FSlateIcon(),
+				FUIAction(FExecuteAction::CreateLambda([WeakTable = Table, Item = Item, Type]()
+				{
+					if (TSharedPtr<SDocumentationLinkTable> PinnedTable = WeakTable.Pin())
+					{
+						PinnedTable->SetItemType(Item, Type);
+					}
+				})));
+		}
+		return MenuBuilder.MakeWidget();
+	}
+
+	/** Only widget for current type is created, type change regenerates row */
+	TSharedRef<SWidget> MakeKeyWidget()
+	{
+		if (!Item->bUserEntry)
+		{
+			return SNew(STextBlock)
+				.Text(FText::FromString(Item->Key))
+				.ToolTipText(FText::FromString(Item->Key));
+		}
+
+		switch (Item->Type)
+		{
+		case EDocumentationLinkType::Asset:
+			return SNew(SObjectPropertyEntryBox)
+				.AllowedClass(UObject::StaticClass())
+				.ObjectPath_Lambda([Item = Item]() { return Item->Key; })
+				.OnObjectChanged(this, &SDocumentationLinkTableRow::OnAssetChanged)
+				.DisplayThumbnail(false)
+				.AllowClear(true);
+
+		case EDocumentationLinkType::Class:
+			return SNew(SHorizontalBox)
+				+ SHorizontalBox::Slot()
+				.FillWidth(1.f)
+				[
+					SNew(SEditableTextBox)
+					.Text_Lambda([Item = Item]() { return FText::FromString(Item->Key); })
+					.OnTextCommitted(this, &SDocumentationLinkTableRow::OnClassPathCommitted)
+				]
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.Padding(2.f, 0.f, 0.f, 0.f)
+				[
+					SNew(SComboButton)
+					.OnGetMenuContent(this, &SDocumentationLinkTableRow::MakeClassPicker)
+					.ToolTipText(LOCTEXT("LinkTable_PickClass", "Pick class"))
+				];
+
+		case EDocumentationLinkType::String:
+		case EDocumentationLinkType::Native:
+		case EDocumentationLinkType::AssetHint:
+		case EDocumentationLinkType::MAX:
+			break;
+		}
+
+		return SNew(SEditableTextBox)
+			.Text_Lambda([Item = Item]() { return FText::FromString(Item->Key); })
+			.OnTextCommitted(this, &SDocumentationLinkTableRow::OnStringKeyCommitted);
+	}
+
+	TSharedRef<SWidget> MakeClassPicker()
+	{
+		FClassViewerInitializationOptions Options;
+		Options.Mode = EClassViewerMode::ClassPicker;
+		Options.DisplayMode = EClassViewerDisplayMode::ListView;
+
+		FClassViewerModule& ClassViewerModule = FModuleManager::LoadModuleChecked<FClassViewerModule>("ClassViewer");
+		return SNew(SBox)
+			.WidthOverride(300.f)
+			.HeightOverride(400.f)
+			[
+				ClassViewerModule.CreateClassViewer(Options, FOnClassPicked::CreateSP(this, &SDocumentationLinkTableRow::OnClassPicked))
+			];
+	}
+
+	void Edit(const FText& Description, TFunctionRef<void(FDocumentationHintLink& Link)> EditFunc)
+	{
+		if (TSharedPtr<SDocumentationLinkTable> PinnedTable = Table.Pin())
+		{
+			PinnedTable->EditItem(Item, Description, EditFunc);
+		}
+	}
+
+	void OnValueCommitted(const FText& InText, ETextCommit::Type CommitType)
+	{
+		if (InText.ToString() != Item->Value)
+		{
+			Edit(LOCTEXT("LinkTable_EditValue", "Edit Link Value"), [&InText](FDocumentationHintLink& Link)
+			{
+				Link.Value = InText.ToString();
+			});
+		}
+	}
+
+	void OnStringKeyCommitted(const FText& InText, ETextCommit::Type CommitType)
+	{
+		if (InText.ToString() != Item->Key)
+		{
+			Edit(LOCTEXT("LinkTable_EditKey", "Edit Link Key"), [&InText](FDocumentationHintLink& Link)
+			{
+				Link.StringKey = InText.ToString();
+			});
+		}
+	}
+
+	void OnAssetChanged(const FAssetData& AssetData)
+	{
+		Edit(LOCTEXT("LinkTable_EditKey", "Edit Link Key"), [&AssetData](FDocumentationHintLink& Link)
+		{
+			Link.AssetKey = TSoftObjectPtr<UObject>(AssetData.GetSoftObjectPath());
+		});
+	}
+
+	void OnClassPathCommitted(const FText& InText, ETextCommit::Type CommitType)
+	{
+		if (InText.ToString() != Item->Key)
+		{
+			Edit(LOCTEXT("LinkTable_EditKey", "Edit Link Key"), [&InText](FDocumentationHintLink& Link)
+			{
+				Link.ClassKey = TSoftClassPtr<UObject>(FSoftObjectPath(InText.ToString()));
+			});
+		}
+	}
+
+	void OnClassPicked(UClass* Class)
+	{
+		FSlateApplication::Get().DismissAllMenus();
+		Edit(LOCTEXT("LinkTable_EditKey", "Edit Link Key"), [Class](FDocumentationHintLink& Link)
+		{
+			Link.ClassKey = Class;
+		});
+	}
+
+	SDocumentationLinkTable::FItemPtr Item;
+	TWeakPtr<SDocumentationLinkTable> Table;
+};
+
+
+
+void SDocumentationLinkTable::Construct(const FArguments& InArgs)
+{
+	SortColumn = DocumentationLinkTableColumns::Key;
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(0.f, 0.f, 0.f, 4.f)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.f)
+			[
+				SNew(SSearchBox)
+				.HintText(LOCTEXT("LinkTable_Filter", "Filter by key, value or source"))
+				.OnTextChanged(this, &SDocumentationLinkTable::OnFilterTextChanged)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(8.f, 0.f)
+			[
+				SNew(STextBlock)
+				.Text(this, &SDocumentationLinkTable::GetCountText)
+				.ColorAndOpacity(FSlateColor::UseSubduedForeground())
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("LinkTable_Add", "Add Link"))
+				.ToolTipText(LOCTEXT("LinkTable_AddTooltip", "Add empty entry to Links"))
+				.OnClicked(this, &SDocumentationLinkTable::OnAddLink)
+			]
+		]
+		+ SVerticalBox::Slot()
+		.FillHeight(1.f)
+		[
+			SAssignNew(ItemsView, SListView<FItemPtr>)
+			.ListItemsSource(&Items)
+			.SelectionMode(ESelectionMode::Single)
+			.OnGenerateRow(this, &SDocumentationLinkTable::OnGenerateRow)
+			.OnContextMenuOpening(this, &SDocumentationLinkTable::OnContextMenuOpening)
+			.HeaderRow
+			(
+				SNew(SHeaderRow)
+				+ SHeaderRow::Column(DocumentationLinkTableColumns::Source)
+				.DefaultLabel(LOCTEXT("LinkTable_Source", "Source"))
+				.FillWidth(0.12f)
+				.SortMode(this, &SDocumentationLinkTable::GetSortMode, DocumentationLinkTableColumns::Source)
+				.OnSort(this, &SDocumentationLinkTable::OnSortModeChanged)
+				+ SHeaderRow::Column(DocumentationLinkTableColumns::Type)
+				.DefaultLabel(LOCTEXT("LinkTable_Type", "Type"))
+				.FillWidth(0.1f)
+				.SortMode(this, &SDocumentationLinkTable::GetSortMode, DocumentationLinkTableColumns::Type)
+				.OnSort(this, &SDocumentationLinkTable::OnSortModeChanged)
+				+ SHeaderRow::Column(DocumentationLinkTableColumns::Key)
+				.DefaultLabel(LOCTEXT("LinkTable_Key", "Key"))
+				.FillWidth(0.45f)
+				.SortMode(this, &SDocumentationLinkTable::GetSortMode, DocumentationLinkTableColumns::Key)
+				.OnSort(this, &SDocumentationLinkTable::OnSortModeChanged)
+				+ SHeaderRow::Column(DocumentationLinkTableColumns::Value)
+				.DefaultLabel(LOCTEXT("LinkTable_Value", "Value"))
+				.FillWidth(0.33f)
+				.SortMode(this, &SDocumentationLinkTable::GetSortMode, DocumentationLinkTableColumns::Value)
+				.OnSort(this, &SDocumentationLinkTable::OnSortModeChanged)
+			)
+		]
+	];
+
+	RefreshItems();
+
+	// Undo, config reload and fixups change arrays outside of table
+	RegisterActiveTimer(0.5f, FWidgetActiveTimerDelegate::CreateSP(this, &SDocumentationLinkTable::CheckForChanges));
+}
+
+void SDocumentationLinkTable::RefreshItems()
+{
+	UDocumentationUtilities* Settings = GetMutableDefault<UDocumentationUtilities>();
+	{
+		FDocumentationLinkReadScope Snapshot;
+		KnownSerial = Snapshot->GetSerial();
+	}
+
+	struct FSource
+	{
+		TArray<FDocumentationHintLink>* Links;
+		FText Name;
+		bool bUserEntry;
+		bool bReadOnly;
+	};
+	const FSource Sources[] =
+	{
+		{ &Settings->NativeLinks, LOCTEXT("LinkTable_SourceNative", "Native"), false, false },
+		{ &Settings->RegisteredNativeLinks, LOCTEXT("LinkTable_SourceRegistered", "Registered"), false, true },
+		{ &Settings->AssetHintLinks, LOCTEXT("LinkTable_SourceAssetHint", "Asset Hint"), false, false },
+		{ &Settings->Links, LOCTEXT("LinkTable_SourceLinks", "Links"), true, false },
+		{ &Settings->LinksOverride, LOCTEXT("LinkTable_SourceOverride", "Override"), true, false },
+	};
+
+	AllItems.Reset();
+	for (const FSource& Source : Sources)
+	{
+		for (int32 Index = 0; Index < Source.Links->Num(); Index++)
+		{
+			const FDocumentationHintLink& Link = (*Source.Links)[Index];
+
+			FItemPtr Item = MakeShared<FDocumentationLinkTableItem>();
+			Item->Source = Source.Links;
+			Item->Index = Index;
+			Item->Serial = KnownSerial;
+			Item->SourceName = Source.Name;
+			Item->bUserEntry = Source.bUserEntry;
+			Item->bReadOnly = Source.bReadOnly;
+			Item->Key = Link.GetLinkKey();
+			Item->Value = Link.Value;
+			Item->Type = Link.Type;
+			AllItems.Add(MoveTemp(Item));
+		}
+	}
+
+	FilterAndSort();
+}
+
+void SDocumentationLinkTable::FilterAndSort()
+{
+	Items.Reset();
+	for (const FItemPtr& Item : AllItems)
+	{
+		if (FilterText.IsEmpty()
+			|| Item->Key.Contains(FilterText)
+			|| Item->Value.Contains(FilterText)
+			|| Item->SourceName.ToString().Contains(FilterText))
+		{
+			Items.Add(Item);
+		}
+	}
+
+	const bool bAscending = SortMode == EColumnSortMode::Ascending;
+	const FName Column = SortColumn;
+
+	// Stable, so entries of equal type or source keep key order of settings
+	Items.StableSort([bAscending, Column](const FItemPtr& A, const FItemPtr& B)
+	{
+		const FDocumentationLinkTableItem& Lhs = bAscending ? *A : *B;
+		const FDocumentationLinkTableItem& Rhs = bAscending ? *B : *A;
+		if (Column == DocumentationLinkTableColumns::Source)
+		{
+			return Lhs.SourceName.CompareTo(Rhs.SourceName) < 0;
+		}
+		if (Column == DocumentationLinkTableColumns::Type)
+		{
+			return Lhs.Type < Rhs.Type;
+		}
+		if (Column == DocumentationLinkTableColumns::Value)
+		{
+			return Lhs.Value.Compare(Rhs.Value, ESearchCase::IgnoreCase) < 0;
+		}
+		return Lhs.Key.Compare(Rhs.Key, ESearchCase::IgnoreCase) < 0;
+	});
+
+	ItemsView->RequestListRefresh();
+}
+
+EActiveTimerReturnType SDocumentationLinkTable::CheckForChanges(double InCurrentTime, float InDeltaTime)
+{
+	uint64 Serial = 0;
+	{
+		FDocumentationLinkReadScope Snapshot;
+		Serial = Snapshot->GetSerial();
+	}
+
+	if (Serial != KnownSerial)
+	{
+		RefreshItems();
+	}
+	return EActiveTimerReturnType::Continue;
+}
+
+bool SDocumentationLinkTable::ValidateItem(const FItemPtr& Item)
+{
+	uint64 Serial = 0;
+	{
+		FDocumentationLinkReadScope Snapshot;
+		Serial = Snapshot->GetSerial();
+	}
+
+	const FDocumentationHintLink* Link = Item->Get();
+	if (Item->Serial == Serial && Link != nullptr && Link->GetLinkKey() == Item->Key)
+	{
+		return true;
+	}
+
+	// Settings changed after last poll, write would land on another entry
+	RefreshItems();
+	return false;
+}
+
+void SDocumentationLinkTable::EditItem(const FItemPtr& Item, const FText& Description, TFunctionRef<void(FDocumentationHintLink& Link)> Edit)
+{
+	if (!Item.IsValid() || Item->bReadOnly || !ValidateItem(Item))
+	{
+		return;
+	}
+	FDocumentationHintLink* Link = Item->Get();
+
+	UDocumentationUtilities* Settings = GetMutableDefault<UDocumentationUtilities>();
+	{
+		FScopedTransaction Transaction(Description);
+		Settings->Modify();
+		Edit(*Link);
+	}
+
+	Item->Key = Link->GetLinkKey();
+	Item->Value = Link->Value;
+	Item->Type = Link->Type;
+
+	Settings->RebuildLinkSnapshot();
+	Settings->TryUpdateDefaultConfigFile();
+
+	// Edited item is up to date and edits do not move entries, skip full refresh so row keeps focus
+	{
+		FDocumentationLinkReadScope Snapshot;
+		KnownSerial = Snapshot->GetSerial();
+	}
+	for (const FItemPtr& Other : AllItems)
+	{
+		Other->Serial = KnownSerial;
+	}
+}
+
+void SDocumentationLinkTable::SetItemType(const FItemPtr& Item, EDocumentationLinkType Type)
+{
+	if (Item->Type == Type)
+	{
+		return;
+	}
+
+	EditItem(Item, LOCTEXT("LinkTable_EditType", "Edit Link Type"), [Type](FDocumentationHintLink& Link)
+	{
+		Link.Type = Type;
+	});
+
+	ItemsView->RebuildList();
+}
+
+TSharedRef<ITableRow> SDocumentationLinkTable::OnGenerateRow(FItemPtr Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(SDocumentationLinkTableRow, OwnerTable, Item, SharedThis(this));
+}
+
+TSharedPtr<SWidget> SDocumentationLinkTable::OnContextMenuOpening()
+{
+	TArray<FItemPtr> Selected = ItemsView->GetSelectedItems();
+	if (Selected.Num() == 0)
+	{
+		return nullptr;
+	}
+	FItemPtr Item = Selected[0];
+
+	FMenuBuilder MenuBuilder(true, nullptr);
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("FindReferences", "Find References"),
+		LOCTEXT("FindReferencesTooltip", "Find References"),
+		FSlateIcon(),
+		FUIAction(FExecuteAction::CreateLambda([Item]()
+		{
+			TArray<FAssetIdentifier> AssetIdentifiers;
+			AssetIdentifiers.Add(FAssetIdentifier(FHintStruct::StaticStruct(), *Item->Key));
+			FEditorDelegates::OnOpenReferenceViewer.Broadcast(AssetIdentifiers, FReferenceViewerParams());
+		})));
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("CopyKey", "Copy Key"),
+		LOCTEXT("CopyKeyTooltip", "Copy Key"),
+		FSlateIcon(),
+		FUIAction(FExecuteAction::CreateLambda([Item]()
+		{
+			FPlatformApplicationMisc::ClipboardCopy(*Item->Key);
+		})));
+
+	if (Item->bUserEntry)
+	{
+		MenuBuilder.AddMenuEntry(
+			LOCTEXT("LinkTable_Remove", "Remove"),
+			LOCTEXT("LinkTable_RemoveTooltip", "Remove entry from settings"),
+			FSlateIcon(),
+			FUIAction(FExecuteAction::CreateSP(this, &SDocumentationLinkTable::RemoveItem, Item)));
+	}
+
+	return MenuBuilder.MakeWidget();
+}
+
+void SDocumentationLinkTable::OnSortModeChanged(EColumnSortPriority::Type Priority, const FName& Column, EColumnSortMode::Type Mode)
+{
+	SortColumn = Column;
+	SortMode = Mode;
+	FilterAndSort();
+}
+
+EColumnSortMode::Type SDocumentationLinkTable::GetSortMode(FName Column) const
+{
+	return Column == SortColumn ? SortMode : EColumnSortMode::None;
+}
+
+void SDocumentationLinkTable::OnFilterTextChanged(const FText& InText)
+{
+	FilterText = InText.ToString();
+	FilterAndSort();
+}
+
+FReply SDocumentationLinkTable::OnAddLink()
+{
+	UDocumentationUtilities* Settings = GetMutableDefault<UDocumentationUtilities>();
+	{
+		FScopedTransaction Transaction(LOCTEXT("LinkTable_AddTransaction", "Add Link"));
+		Settings->Modify();
+		Settings->Links.AddDefaulted();
+	}
+	Settings->RebuildLinkSnapshot();
+	Settings->TryUpdateDefaultConfigFile();
+
+	RefreshItems();
+
+	const TArray<FDocumentationHintLink>* Links = &Settings->Links;
+	const int32 NewIndex = Links->Num() - 1;
+	if (const FItemPtr* NewItem = AllItems.FindByPredicate([Links, NewIndex](const FItemPtr& Item) { return Item->Source == Links && Item->Index == NewIndex; }))
+	{
+		// New entry has empty key, it may be hidden by filter
+		if (Items.Contains(*NewItem))
+		{
+			ItemsView->SetSelection(*NewItem);
+			ItemsView->RequestScrollIntoView(*NewItem);
+		}
+	}
+	return FReply::Handled();
+}
+
+void SDocumentationLinkTable::RemoveItem(FItemPtr Item)
+{
+	if (!Item.IsValid() || !Item->bUserEntry || !ValidateItem(Item))
+	{
+		return;
+	}
+
+	UDocumentationUtilities* Settings = GetMutableDefault<UDocumentationUtilities>();
+	{
+		FScopedTransaction Transaction(LOCTEXT("LinkTable_RemoveTransaction", "Remove Link"));
+		Settings->Modify();
+		Item->Source->RemoveAt(Item->Index);
+	}
+	Settings->RebuildLinkSnapshot();
+	Settings->TryUpdateDefaultConfigFile();
+
+	RefreshItems();
+}
+
+FText SDocumentationLinkTable::GetCountText() const
+{
+	return FText::Format(LOCTEXT("LinkTable_Count", "{0} of {1}"), FText::AsNumber(Items.Num()), FText::AsNumber(AllItems.Num()));
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,88 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+
+struct FDocumentationHintLink;
+enum class EDocumentationLinkType : uint8;
+
+/** Entry of one of settings link arrays */
+struct FDocumentationLinkTableItem
+{
+	TArray<FDocumentationHintLink>* Source = nullptr;
+	int32 Index = INDEX_NONE;
+
+	/** Snapshot serial Index was taken at, arrays may have shifted since */
+	uint64 Serial = 0;
+
+	FText SourceName;
+
+	/** Links and LinksOverride, other arrays are generated and only their values can be edited */
+	bool bUserEntry = false;
+
+	/** Declared in code, set value in Native entry of the same key to override it */
+	bool bReadOnly = false;
+
+	/** Copies for sorting and filtering */
+	FString Key;
+	FString Value;
+	EDocumentationLinkType Type;
+
+	FDocumentationHintLink* Get() const;
+};
+
+/**
+ * Link arrays of documentation settings in one virtualized table
+ *
+ * Only visible rows have widgets, and key column creates picker only for entry type
+ * Sorting by any column, filter matches key, value and source
+ * Rebuilt when link snapshot changes, for example after undo or config reload
+ */
+class SDocumentationLinkTable : public SCompoundWidget
+{
+public:
+	using FItemPtr = TSharedPtr<FDocumentationLinkTableItem>;
+
+	SLATE_BEGIN_ARGS(SDocumentationLinkTable) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	/** Apply change to entry in one transaction, then rebuild snapshot and write config */
+	void EditItem(const FItemPtr& Item, const FText& Description, TFunctionRef<void(FDocumentationHintLink& Link)> Edit);
+
+	/** Type change replaces key widget, row is generated again */
+	void SetItemType(const FItemPtr& Item, EDocumentationLinkType Type);
+
+private:
+	void RefreshItems();
+
+	/** Entry of item is still at its index. Refreshes items when it is not */
+	bool ValidateItem(const FItemPtr& Item);
+	void FilterAndSort();
+
+	EActiveTimerReturnType CheckForChanges(double InCurrentTime, float InDeltaTime);
+
+	TSharedRef<ITableRow> OnGenerateRow(FItemPtr Item, const TSharedRef<STableViewBase>& OwnerTable);
+	TSharedPtr<SWidget> OnContextMenuOpening();
+	void OnSortModeChanged(EColumnSortPriority::Type Priority, const FName& Column, EColumnSortMode::Type Mode);
+	EColumnSortMode::Type GetSortMode(FName Column) const;
+	void OnFilterTextChanged(const FText& InText);
+
+	FReply OnAddLink();
+	void RemoveItem(FItemPtr Item);
+	FText GetCountText() const;
+
+	TArray<FItemPtr> AllItems;
+	TArray<FItemPtr> Items;
+	TSharedPtr<SListView<FItemPtr>> ItemsView;
+
+	FString FilterText;
+	FName SortColumn;
+	EColumnSortMode::Type SortMode = EColumnSortMode::Ascending;
+
+	uint64 KnownSerial = 0;
+};
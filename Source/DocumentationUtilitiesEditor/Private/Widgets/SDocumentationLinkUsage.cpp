@@ -0,0 +1,241 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "SDocumentationLinkUsage.h"
+#include "DocumentationUtilitiesEditor.h"
+#include "DocumentationUtilitiesSettings.h"
+
+#include <Widgets/Input/SButton.h>
+#include <Widgets/Input/SCheckBox.h>
+#include <Widgets/Text/STextBlock.h>
+
+
+
+#define LOCTEXT_NAMESPACE "DocumentationUtilities"
+
+namespace DocumentationLinkUsageColumns
+{
+	static const FName Link = TEXT("Link");
+	static const FName Clicks = TEXT("Clicks");
+	static const FName LastUsed = TEXT("LastUsed");
+}
+
+class SDocumentationLinkUsageRow : public SMultiColumnTableRow<TSharedPtr<FDocumentationLinkUsage::FUsage>>
+{
+public:
+	SLATE_BEGIN_ARGS(SDocumentationLinkUsageRow) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& OwnerTable, TSharedPtr<FDocumentationLinkUsage::FUsage> InItem)
+	{
+		Item = InItem;
+		SMultiColumnTableRow<TSharedPtr<FDocumentationLinkUsage::FUsage>>::Construct(FSuperRowType::FArguments(), OwnerTable);
+	}
+
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override
+	{
+		FText Text;
+		if (ColumnName == DocumentationLinkUsageColumns::Link)
+		{
+			Text = FText::FromString(Item->LinkKey);
+		}
+		else if (ColumnName == DocumentationLinkUsageColumns::Clicks)
+		{
+			Text = FText::AsNumber(Item->Clicks);
+		}
+		else if (ColumnName == DocumentationLinkUsageColumns::LastUsed)
+		{
+			Text = Item->Clicks > 0 ? FText::AsDateTime(Item->LastUsed) : LOCTEXT("LinkUsage_Never", "Never");
+		}
+
+		return SNew(STextBlock)
+			.Text(Text)
+			.ColorAndOpacity(Item->Clicks > 0 ? FSlateColor::UseForeground() : FSlateColor::UseSubduedForeground());
+	}
+
+private:
+	TSharedPtr<FDocumentationLinkUsage::FUsage> Item;
+};
+
+
+
+const FName SDocumentationLinkUsage::TabName = TEXT("DocumentationLinkUsage");
+
+void SDocumentationLinkUsage::Construct(const FArguments& InArgs)
+{
+	SortColumn = DocumentationLinkUsageColumns::Clicks;
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(4.f)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				SNew(SCheckBox)
+				.IsChecked_Lambda([this]() { return bNeverUsedOnly ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+				.OnCheckStateChanged_Lambda([this](ECheckBoxState State)
+				{
+					bNeverUsedOnly = State == ECheckBoxState::Checked;
+					Refresh();
+				})
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("LinkUsage_NeverUsed", "Never used only"))
+				]
+			]
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.f)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("LinkUsage_Refresh", "Refresh"))
+				.OnClicked_Lambda([this]()
+				{
+					Refresh();
+					return FReply::Handled();
+				})
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(4.f, 0.f, 0.f, 0.f)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("LinkUsage_Reset", "Reset"))
+				.ToolTipText(LOCTEXT("LinkUsage_ResetTooltip", "Clear all recorded clicks"))
+				.OnClicked_Lambda([this]()
+				{
+					FDocumentationLinkUsage::Get().Reset();
+					Refresh();
+					return FReply::Handled();
+				})
+			]
+		]
+		+ SVerticalBox::Slot()
+		.FillHeight(1.f)
+		[
+			SAssignNew(RowsView, SListView<FRowPtr>)
+			.ListItemsSource(&Rows)
+			.SelectionMode(ESelectionMode::Single)
+			.OnGenerateRow(this, &SDocumentationLinkUsage::OnGenerateRow)
+			.OnMouseButtonDoubleClick(this, &SDocumentationLinkUsage::OnRowDoubleClicked)
+			.HeaderRow
+			(
+				SNew(SHeaderRow)
+				+ SHeaderRow::Column(DocumentationLinkUsageColumns::Link)
+				.DefaultLabel(LOCTEXT("LinkUsage_Link", "Link"))
+				.FillWidth(0.6f)
+				.SortMode(this, &SDocumentationLinkUsage::GetSortMode, DocumentationLinkUsageColumns::Link)
+				.OnSort(this, &SDocumentationLinkUsage::OnSortModeChanged)
+				+ SHeaderRow::Column(DocumentationLinkUsageColumns::Clicks)
+				.DefaultLabel(LOCTEXT("LinkUsage_Clicks", "Clicks"))
+				.FillWidth(0.15f)
+				.SortMode(this, &SDocumentationLinkUsage::GetSortMode, DocumentationLinkUsageColumns::Clicks)
+				.OnSort(this, &SDocumentationLinkUsage::OnSortModeChanged)
+				+ SHeaderRow::Column(DocumentationLinkUsageColumns::LastUsed)
+				.DefaultLabel(LOCTEXT("LinkUsage_LastUsed", "Last Used"))
+				.FillWidth(0.25f)
+				.SortMode(this, &SDocumentationLinkUsage::GetSortMode, DocumentationLinkUsageColumns::LastUsed)
+				.OnSort(this, &SDocumentationLinkUsage::OnSortModeChanged)
+			)
+		]
+	];
+
+	Refresh();
+}
+
+void SDocumentationLinkUsage::Refresh()
+{
+	TArray<FDocumentationLinkUsage::FUsage> Usage;
+	FDocumentationLinkUsage::Get().GetUsage(Usage);
+
+	TMap<FString, FDocumentationLinkUsage::FUsage> ByKey;
+	for (FDocumentationLinkUsage::FUsage& Item : Usage)
+	{
+		if (Item.Clicks > 0)
+		{
+			ByKey.Add(Item.LinkKey, MoveTemp(Item));
+		}
+	}
+
+	// Links that exist in settings but were never opened
+	for (const TArray<FDocumentationHintLink>* Source : GetDefault<UDocumentationUtilities>()->GetSources())
+	{
+		for (const FDocumentationHintLink& Link : *Source)
+		{
+			if (Link.HasValue())
+			{
+				const FString Key = Link.GetLinkKey();
+				if (!ByKey.Contains(Key))
+				{
+					ByKey.Add(Key).LinkKey = Key;
+				}
+			}
+		}
+	}
+
+	Rows.Reset();
+	for (TPair<FString, FDocumentationLinkUsage::FUsage>& Pair : ByKey)
+	{
+		if (!bNeverUsedOnly || Pair.Value.Clicks == 0)
+		{
+			Rows.Add(MakeShared<FDocumentationLinkUsage::FUsage>(MoveTemp(Pair.Value)));
+		}
+	}
+
+	SortRows();
+}
+
+void SDocumentationLinkUsage::SortRows()
+{
+	const bool bAscending = SortMode == EColumnSortMode::Ascending;
+	const FName Column = SortColumn;
+
+	Rows.Sort([bAscending, Column](const FRowPtr& A, const FRowPtr& B)
+	{
+		if (Column == DocumentationLinkUsageColumns::Link)
+		{
+			return bAscending ? A->LinkKey < B->LinkKey : B->LinkKey < A->LinkKey;
+		}
+		if (Column == DocumentationLinkUsageColumns::LastUsed)
+		{
+			return bAscending ? A->LastUsed < B->LastUsed : B->LastUsed < A->LastUsed;
+		}
+		return bAscending ? A->Clicks < B->Clicks : B->Clicks < A->Clicks;
+	});
+
+	RowsView->RequestListRefresh();
+}
+
+void SDocumentationLinkUsage::OnSortModeChanged(EColumnSortPriority::Type Priority, const FName& Column, EColumnSortMode::Type Mode)
+{
+	SortColumn = Column;
+	SortMode = Mode;
+	SortRows();
+}
+
+EColumnSortMode::Type SDocumentationLinkUsage::GetSortMode(FName Column) const
+{
+	return Column == SortColumn ? SortMode : EColumnSortMode::None;
+}
+
+TSharedRef<ITableRow> SDocumentationLinkUsage::OnGenerateRow(FRowPtr Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(SDocumentationLinkUsageRow, OwnerTable, Item);
+}
+
+void SDocumentationLinkUsage::OnRowDoubleClicked(FRowPtr Item)
+{
+	if (Item.IsValid())
+	{
+		IDocumentationUtilitiesEditorModule::OpenLink(Item->LinkKey);
+		Refresh();
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,41 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "DocumentationLinkUsage.h"
+
+/**
+ * Report of opened links
+ * Lists link keys from settings and recorded clicks, most used first. Keys that were never opened can be shown separately
+ */
+class SDocumentationLinkUsage : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SDocumentationLinkUsage) {}
+	SLATE_END_ARGS()
+
+	static const FName TabName;
+
+	void Construct(const FArguments& InArgs);
+
+private:
+	using FRowPtr = TSharedPtr<FDocumentationLinkUsage::FUsage>;
+
+	void Refresh();
+	void SortRows();
+
+	TSharedRef<ITableRow> OnGenerateRow(FRowPtr Item, const TSharedRef<STableViewBase>& OwnerTable);
+	void OnSortModeChanged(EColumnSortPriority::Type Priority, const FName& Column, EColumnSortMode::Type Mode);
+	EColumnSortMode::Type GetSortMode(FName Column) const;
+	void OnRowDoubleClicked(FRowPtr Item);
+
+	TArray<FRowPtr> Rows;
+	TSharedPtr<SListView<FRowPtr>> RowsView;
+
+	FName SortColumn;
+	EColumnSortMode::Type SortMode = EColumnSortMode::Descending;
+	bool bNeverUsedOnly = false;
+};
@@ -0,0 +1,219 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "SDocumentationPalette.h"
+#include "DocumentationUtilitiesEditor.h"
+#include "DocumentationLinkSnapshot.h"
+#include "Search/DocumentationFuzzyMatcher.h"
+
+#include <Framework/Application/SlateApplication.h>
+#include <Widgets/Input/SSearchBox.h>
+#include <Widgets/Layout/SBorder.h>
+#include <Widgets/SWindow.h>
+#include <Widgets/Text/STextBlock.h>
+
+
+
+#define LOCTEXT_NAMESPACE "DocumentationUtilities"
+
+namespace DocumentationPalette
+{
+	static constexpr int32 MaxResults = 50;
+}
+
+TWeakPtr<SWindow> SDocumentationPalette::OpenWindow;
+
+void SDocumentationPalette::Open()
+{
+	if (TSharedPtr<SWindow> Existing = OpenWindow.Pin())
+	{
+		Existing->BringToFront(true);
+		return;
+	}
+
+	TSharedRef<SDocumentationPalette> Palette = SNew(SDocumentationPalette);
+
+	TSharedRef<SWindow> Window = SNew(SWindow)
+		.Title(LOCTEXT("DocumentationPalette", "Open Documentation"))
+		.ClientSize(FVector2D(640.f, 420.f))
+		.SizingRule(ESizingRule::FixedSize)
+		.AutoCenter(EAutoCenter::PreferredWorkArea)
+		.CreateTitleBar(false)
+		.SupportsMaximize(false)
+		.SupportsMinimize(false)
+		.IsTopmostWindow(true)
+		.FocusWhenFirstShown(true)
+		[
+			Palette
+		];
+
+	TWeakPtr<SWindow> WeakWindow = Window;
+	Window->GetOnWindowDeactivatedEvent().AddLambda([WeakWindow]()
+	{
+		if (TSharedPtr<SWindow> PinnedWindow = WeakWindow.Pin())
+		{
+			PinnedWindow->RequestDestroyWindow();
+		}
+	});
+
+	OpenWindow = Window;
+	FSlateApplication::Get().AddWindow(Window);
+	FSlateApplication::Get().SetKeyboardFocus(Palette->SearchBox, EFocusCause::SetDirectly);
+}
+
+FDocumentationFuzzyMatcher& SDocumentationPalette::GetMatcher()
+{
+	static FDocumentationFuzzyMatcher Matcher;
+	static uint64 Serial = 0;
+
+	FDocumentationLinkReadScope Snapshot;
+	if (Snapshot->GetSerial() != Serial || Matcher.Num() != Snapshot->Num())
+	{
+		Serial = Snapshot->GetSerial();
+
+		TArray<FString> Keys;
+		Keys.Reserve(Snapshot->Num());
+		Snapshot->ForEachLink([&Keys](const FString& Key, const FString& Value)
+		{
+			Keys.Add(Key);
+		});
+		Matcher.Reset(MoveTemp(Keys));
+	}
+	return Matcher;
+}
+
+void SDocumentationPalette::Construct(const FArguments& InArgs)
+{
+	ChildSlot
+	[
+		SNew(SBorder)
+		.BorderImage(FAppStyle::GetBrush("Menu.Background"))
+		.Padding(4.f)
+		[
+			SNew(SVerticalBox)
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(0.f, 0.f, 0.f, 4.f)
+			[
+				SAssignNew(SearchBox, SSearchBox)
+				.HintText(LOCTEXT("DocumentationPalette_Hint", "Class, asset or link"))
+				.OnTextChanged(this, &SDocumentationPalette::OnSearchTextChanged)
+				.OnTextCommitted(this, &SDocumentationPalette::OnSearchTextCommitted)
+			]
+			+ SVerticalBox::Slot()
+			.FillHeight(1.f)
+			[
+				SAssignNew(ItemsView, SListView<FItemPtr>)
+				.ListItemsSource(&Items)
+				.SelectionMode(ESelectionMode::Single)
+				.OnGenerateRow(this, &SDocumentationPalette::OnGenerateRow)
+				.OnMouseButtonDoubleClick(this, &SDocumentationPalette::OpenItem)
+			]
+		]
+	];
+}
+
+FReply SDocumentationPalette::OnPreviewKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent)
+{
+	const FKey Key = InKeyEvent.GetKey();
+	if (Key == EKeys::Escape)
+	{
+		Close();
+		return FReply::Handled();
+	}
+
+	if ((Key == EKeys::Up || Key == EKeys::Down) && Items.Num() > 0)
+	{
+		TArray<FItemPtr> Selected = ItemsView->GetSelectedItems();
+		int32 Index = Selected.Num() > 0 ? Items.IndexOfByKey(Selected[0]) : INDEX_NONE;
+		Index = FMath::Clamp(Index + (Key == EKeys::Up ? -1 : 1), 0, Items.Num() - 1);
+
+		ItemsView->SetSelection(Items[Index], ESelectInfo::OnNavigation);
+		ItemsView->RequestScrollIntoView(Items[Index]);
+		return FReply::Handled();
+	}
+
+	return SCompoundWidget::OnPreviewKeyDown(MyGeometry, InKeyEvent);
+}
+
+void SDocumentationPalette::OnSearchTextChanged(const FText& InText)
+{
+	SearchText = InText.ToString();
+
+	FDocumentationFuzzyMatcher& Matcher = GetMatcher();
+
+	TArray<FDocumentationFuzzyMatcher::FMatch> Matches;
+	Matcher.Query(SearchText, DocumentationPalette::MaxResults, Matches);
+
+	Items.Reset(Matches.Num());
+	for (const FDocumentationFuzzyMatcher::FMatch& Match : Matches)
+	{
+		Items.Add(MakeShared<FString>(Matcher.GetKey(Match.Index)));
+	}
+
+	ItemsView->RequestListRefresh();
+	if (Items.Num() > 0)
+	{
+		ItemsView->SetSelection(Items[0], ESelectInfo::Direct);
+		ItemsView->RequestScrollIntoView(Items[0]);
+	}
+}
+
+void SDocumentationPalette::OnSearchTextCommitted(const FText& InText, ETextCommit::Type CommitType)
+{
+	if (CommitType == ETextCommit::OnEnter)
+	{
+		TArray<FItemPtr> Selected = ItemsView->GetSelectedItems();
+		OpenItem(Selected.Num() > 0 ? Selected[0] : (Items.Num() > 0 ? Items[0] : nullptr));
+	}
+}
+
+void SDocumentationPalette::OpenItem(FItemPtr Item)
+{
+	if (!Item.IsValid())
+	{
+		return;
+	}
+
+	// Close first, link may open editor window that takes focus
+	const FString Link = *Item;
+	Close();
+	IDocumentationUtilitiesEditorModule::OpenLink(Link);
+}
+
+void SDocumentationPalette::Close()
+{
+	if (TSharedPtr<SWindow> Window = OpenWindow.Pin())
+	{
+		Window->RequestDestroyWindow();
+	}
+	OpenWindow.Reset();
+}
+
+TSharedRef<ITableRow> SDocumentationPalette::OnGenerateRow(FItemPtr Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	// Asset or class name after the path
+	const int32 SeparatorIndex = Item->FindLastCharByPredicate([](TCHAR Char) { return Char == TEXT('.') || Char == TEXT('/'); });
+	const FString Name = SeparatorIndex != INDEX_NONE ? Item->RightChop(SeparatorIndex + 1) : *Item;
+
+	return SNew(STableRow<FItemPtr>, OwnerTable)
+		.Padding(FMargin(4.f, 2.f))
+		[
+			SNew(SVerticalBox)
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			[
+				SNew(STextBlock)
+				.Text(FText::FromString(Name))
+				.Font(FAppStyle::GetFontStyle("BoldFont"))
+			]
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			[
+				SNew(STextBlock)
+				.Text(FText::FromString(*Item))
+				.ColorAndOpacity(FSlateColor::UseSubduedForeground())
+			]
+		];
+}
+
+#undef LOCTEXT_NAMESPACE
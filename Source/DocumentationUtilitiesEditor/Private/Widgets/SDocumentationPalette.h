@@ -0,0 +1,51 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+
+class SSearchBox;
+class SWindow;
+class FDocumentationFuzzyMatcher;
+
+/**
+ * Popup with fuzzy search over documented link keys
+ * Enter or double click opens selected key with OpenLink
+ */
+class SDocumentationPalette : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SDocumentationPalette) {}
+	SLATE_END_ARGS()
+
+	/** Show palette window, or focus it if already open */
+	static void Open();
+
+	void Construct(const FArguments& InArgs);
+
+	//~ Begin SWidget Interface
+	virtual FReply OnPreviewKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent) override;
+	//~ End SWidget Interface
+
+private:
+	using FItemPtr = TSharedPtr<FString>;
+
+	/** Corpus is rebuilt only when link snapshot changes */
+	static FDocumentationFuzzyMatcher& GetMatcher();
+
+	void OnSearchTextChanged(const FText& InText);
+	void OnSearchTextCommitted(const FText& InText, ETextCommit::Type CommitType);
+	void OpenItem(FItemPtr Item);
+	void Close();
+
+	TSharedRef<ITableRow> OnGenerateRow(FItemPtr Item, const TSharedRef<STableViewBase>& OwnerTable);
+
+	FString SearchText;
+	TArray<FItemPtr> Items;
+	TSharedPtr<SListView<FItemPtr>> ItemsView;
+	TSharedPtr<SSearchBox> SearchBox;
+
+	static TWeakPtr<SWindow> OpenWindow;
+};
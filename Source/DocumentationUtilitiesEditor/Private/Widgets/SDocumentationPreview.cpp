@@ -0,0 +1,76 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "SDocumentationPreview.h"
+#include "DocumentationPreviewCache.h"
+
+#include <Widgets/Text/STextBlock.h>
+
+
+
+void SDocumentationPreview::Construct(const FArguments& InArgs)
+{
+	Address = InArgs._Address;
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(0.f, 0.f, 0.f, 4.f)
+		[
+			SNew(STextBlock)
+			.Text(this, &SDocumentationPreview::GetTitleText)
+			.Visibility(this, &SDocumentationPreview::GetTitleVisibility)
+			.Font(FAppStyle::GetFontStyle("BoldFont"))
+		]
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(0.f, 0.f, 0.f, 4.f)
+		[
+			SNew(STextBlock)
+			.Text(this, &SDocumentationPreview::GetSummaryText)
+			.Visibility(this, &SDocumentationPreview::GetSummaryVisibility)
+			.WrapTextAt(400.f)
+		]
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		[
+			SNew(STextBlock)
+			.Text(FText::FromString(Address))
+			.ColorAndOpacity(FSlateColor::UseSubduedForeground())
+		]
+	];
+}
+
+TSharedPtr<const FDocumentationPreview> SDocumentationPreview::GetPreview() const
+{
+	if (!Preview.IsValid())
+	{
+		Preview = FDocumentationPreviewCache::Get().Request(Address);
+	}
+	return Preview;
+}
+
+EVisibility SDocumentationPreview::GetTitleVisibility() const
+{
+	TSharedPtr<const FDocumentationPreview> Current = GetPreview();
+	return Current.IsValid() && !Current->Title.IsEmpty() ? EVisibility::Visible : EVisibility::Collapsed;
+}
+
+EVisibility SDocumentationPreview::GetSummaryVisibility() const
+{
+	TSharedPtr<const FDocumentationPreview> Current = GetPreview();
+	return Current.IsValid() && !Current->Summary.IsEmpty() ? EVisibility::Visible : EVisibility::Collapsed;
+}
+
+FText SDocumentationPreview::GetTitleText() const
+{
+	TSharedPtr<const FDocumentationPreview> Current = GetPreview();
+	return Current.IsValid() ? FText::FromString(Current->Title) : FText::GetEmpty();
+}
+
+FText SDocumentationPreview::GetSummaryText() const
+{
+	TSharedPtr<const FDocumentationPreview> Current = GetPreview();
+	return Current.IsValid() ? FText::FromString(Current->Summary) : FText::GetEmpty();
+}
@@ -0,0 +1,35 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+
+struct FDocumentationPreview;
+
+/**
+ * Tooltip content with title and first paragraph of linked page
+ * Shows address alone while preview is loading or when page has no local copy
+ */
+class SDocumentationPreview : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SDocumentationPreview) {}
+		/** Resolved link address */
+		SLATE_ARGUMENT(FString, Address)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+private:
+	/** Preview is requested on first paint, so it loads when tooltip is shown */
+	TSharedPtr<const FDocumentationPreview> GetPreview() const;
+
+	EVisibility GetTitleVisibility() const;
+	EVisibility GetSummaryVisibility() const;
+	FText GetTitleText() const;
+	FText GetSummaryText() const;
+
+	FString Address;
+	mutable TSharedPtr<const FDocumentationPreview> Preview;
+};
@@ -0,0 +1,145 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#include "SDocumentationSearch.h"
+#include "DocumentationUtilitiesEditor.h"
+
+#include <Widgets/Input/SSearchBox.h>
+#include <Widgets/Input/SButton.h>
+#include <Widgets/Layout/SBox.h>
+#include <Widgets/Text/STextBlock.h>
+
+
+
+#define LOCTEXT_NAMESPACE "DocumentationUtilities"
+
+namespace DocumentationSearch
+{
+	static constexpr int32 MaxResults = 200;
+}
+
+const FName SDocumentationSearch::TabName = TEXT("DocumentationSearch");
+
+SDocumentationSearch::~SDocumentationSearch()
+{
+	FDocumentationSearchIndex::Get().OnIndexUpdated.RemoveAll(this);
+}
+
+void SDocumentationSearch::Construct(const FArguments& InArgs)
+{
+	FDocumentationSearchIndex::Get().OnIndexUpdated.AddSP(this, &SDocumentationSearch::OnIndexUpdated);
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(4.f)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.f)
+			[
+				SAssignNew(SearchBox, SSearchBox)
+				.HintText(LOCTEXT("SearchDocumentation_Hint", "Search hints and links"))
+				.OnTextChanged(this, &SDocumentationSearch::OnSearchTextChanged)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(4.f, 0.f, 0.f, 0.f)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("SearchDocumentation_Rebuild", "Rebuild"))
+				.ToolTipText(LOCTEXT("SearchDocumentation_RebuildTooltip", "Collect all hints and links again"))
+				.OnClicked_Lambda([]()
+				{
+					FDocumentationSearchIndex::Get().RequestRebuild();
+					return FReply::Handled();
+				})
+			]
+		]
+		+ SVerticalBox::Slot()
+		.FillHeight(1.f)
+		[
+			SAssignNew(ResultsView, SListView<FResultPtr>)
+			.ListItemsSource(&Results)
+			.SelectionMode(ESelectionMode::Single)
+			.OnGenerateRow(this, &SDocumentationSearch::OnGenerateRow)
+			.OnMouseButtonDoubleClick(this, &SDocumentationSearch::OnResultDoubleClicked)
+		]
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(4.f)
+		[
+			SNew(STextBlock)
+			.Text(this, &SDocumentationSearch::GetStatusText)
+		]
+	];
+}
+
+void SDocumentationSearch::OnSearchTextChanged(const FText& InText)
+{
+	SearchText = InText.ToString();
+	RefreshResults();
+}
+
+void SDocumentationSearch::OnIndexUpdated()
+{
+	RefreshResults();
+}
+
+void SDocumentationSearch::RefreshResults()
+{
+	TArray<FDocumentationSearchDocument> Found;
+	FDocumentationSearchIndex::Get().Query(SearchText, DocumentationSearch::MaxResults, Found);
+
+	Results.Reset(Found.Num());
+	for (FDocumentationSearchDocument& Document : Found)
+	{
+		Results.Add(MakeShared<FDocumentationSearchDocument>(MoveTemp(Document)));
+	}
+	ResultsView->RequestListRefresh();
+}
+
+TSharedRef<ITableRow> SDocumentationSearch::OnGenerateRow(FResultPtr Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(STableRow<FResultPtr>, OwnerTable)
+		.ToolTipText(FText::FromString(Item->Text))
+		[
+			SNew(SVerticalBox)
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			[
+				SNew(STextBlock)
+				.Text(FText::FromString(Item->Title))
+				.HighlightText_Lambda([this]() { return FText::FromString(SearchText); })
+			]
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			[
+				SNew(STextBlock)
+				.Text(FText::FromString(Item->Link))
+				.ColorAndOpacity(FSlateColor::UseSubduedForeground())
+				.Visibility(Item->Link.IsEmpty() ? EVisibility::Collapsed : EVisibility::Visible)
+			]
+		];
+}
+
+void SDocumentationSearch::OnResultDoubleClicked(FResultPtr Item)
+{
+	if (Item.IsValid() && !Item->Link.IsEmpty())
+	{
+		IDocumentationUtilitiesEditorModule::OpenLink(Item->Link);
+	}
+}
+
+FText SDocumentationSearch::GetStatusText() const
+{
+	const FDocumentationSearchIndex& Index = FDocumentationSearchIndex::Get();
+	if (!Index.IsReady())
+	{
+		return LOCTEXT("SearchDocumentation_Indexing", "Indexing...");
+	}
+	return FText::Format(LOCTEXT("SearchDocumentation_Status", "{0} results, {1} documents indexed"), Results.Num(), Index.GetNumDocuments());
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,43 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "Search/DocumentationSearchIndex.h"
+
+class SSearchBox;
+
+/**
+ * Full-text search over documentation hints and links
+ * Double click on result opens its link
+ */
+class SDocumentationSearch : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SDocumentationSearch) {}
+	SLATE_END_ARGS()
+
+	static const FName TabName;
+
+	virtual ~SDocumentationSearch() override;
+
+	void Construct(const FArguments& InArgs);
+
+private:
+	using FResultPtr = TSharedPtr<FDocumentationSearchDocument>;
+
+	void OnSearchTextChanged(const FText& InText);
+	void OnIndexUpdated();
+	void RefreshResults();
+
+	TSharedRef<ITableRow> OnGenerateRow(FResultPtr Item, const TSharedRef<STableViewBase>& OwnerTable);
+	void OnResultDoubleClicked(FResultPtr Item);
+	FText GetStatusText() const;
+
+	FString SearchText;
+	TArray<FResultPtr> Results;
+	TSharedPtr<SListView<FResultPtr>> ResultsView;
+	TSharedPtr<SSearchBox> SearchBox;
+};
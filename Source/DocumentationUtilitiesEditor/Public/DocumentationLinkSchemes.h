@@ -0,0 +1,84 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+DECLARE_DELEGATE_OneParam(FOnOpenDocumentationLink, const FString& /*Payload*/);
+DECLARE_DELEGATE_RetVal_OneParam(bool, FOnValidateDocumentationLink, const FString& /*Payload*/);
+
+/** Handler for addresses in form 'Scheme:Payload' */
+struct FDocumentationLinkScheme
+{
+	/** Open link */
+	FOnOpenDocumentationLink OnOpen;
+
+	/** Optional syntax check of the payload. Result is cached, do not depend on external state */
+	FOnValidateDocumentationLink OnValidate;
+
+	/** Optional, called when user hovers the link. Start loading target so opening is instant */
+	FOnOpenDocumentationLink OnPrefetch;
+
+	/** Pass full address as payload instead of the part after ':'. Required for URLs */
+	bool bKeepPrefix = false;
+
+	FDocumentationLinkScheme() = default;
+
+	FDocumentationLinkScheme(FOnOpenDocumentationLink InOnOpen, bool bInKeepPrefix = false)
+		: OnOpen(InOnOpen)
+		, bKeepPrefix(bInKeepPrefix)
+	{ }
+};
+
+/** Address split into scheme and payload */
+struct FDocumentationParsedLink
+{
+	/** None if address has no registered scheme */
+	FName Scheme;
+	FString Payload;
+
+	bool IsValid() const { return !Scheme.IsNone(); }
+};
+
+/**
+ * Registry of link schemes used by OpenLink and IsLinkValid
+ *
+ * Built-in: 'http', 'https', 'Edit', 'View'
+ * Addresses starting with '/' are treated as 'View' links
+ *
+ * Each address is parsed once, repeated checks are map lookups
+ * Game thread only
+ */
+class DOCUMENTATIONUTILITIESEDITOR_API FDocumentationLinkSchemes
+{
+public:
+	static FDocumentationLinkSchemes& Get();
+
+	/** Add or replace scheme handler. Scheme names are case insensitive */
+	void RegisterScheme(FName Scheme, const FDocumentationLinkScheme& Handler);
+	void UnregisterScheme(FName Scheme);
+	bool IsSchemeRegistered(FName Scheme) const { return Schemes.Contains(Scheme); }
+
+	/** Parse already resolved address */
+	const FDocumentationParsedLink& Parse(const FString& Address);
+
+	/** Run scheme handler for resolved address. Returns false if address has no valid scheme */
+	bool Open(const FString& Address);
+
+	/** Run prefetch handler for resolved address, if scheme has one */
+	void Prefetch(const FString& Address);
+
+	/** Number and heap memory of parsed addresses cache */
+	int32 GetNumParsedLinks() const { return ParsedLinks.Num(); }
+	SIZE_T GetAllocatedSize() const;
+
+	/** Scheme used for addresses that start with '/' */
+	static const FName PathScheme;
+
+private:
+	FDocumentationParsedLink ParseUncached(const FString& Address) const;
+
+	TMap<FName, FDocumentationLinkScheme> Schemes;
+	TMap<FString, FDocumentationParsedLink> ParsedLinks;
+};
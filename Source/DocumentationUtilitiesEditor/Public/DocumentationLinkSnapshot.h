@@ -0,0 +1,101 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+
+class UDocumentationUtilities;
+
+/**
+ * Immutable copy of all link sources, merged by priority
+ * New snapshot is published every time settings change, existing snapshots are never modified
+ *
+ * Use FDocumentationLinkReadScope to access current snapshot from any thread
+ */
+class DOCUMENTATIONUTILITIESEDITOR_API FDocumentationLinkSnapshot
+{
+public:
+	/** Value of the first source that has this key with value */
+	const FString* FindValue(const FString& Key) const { return Links.Find(Key); }
+	const FString* FindValue(FStringView Key) const { return Links.FindByHash(HashKey(Key), Key); }
+
+	/** Link value or the key itself. Result points into snapshot or into Key */
+	FStringView Resolve(FStringView Key) const
+	{
+		const FString* Value = FindValue(Key);
+		return Value ? FStringView(*Value) : Key;
+	}
+
+	/** Resolve every key, OutAddresses must have the same size as Keys. No allocations */
+	void ResolveLinks(TConstArrayView<FStringView> Keys, TArrayView<FStringView> OutAddresses) const
+	{
+		check(Keys.Num() == OutAddresses.Num());
+		for (int32 Index = 0; Index < Keys.Num(); Index++)
+		{
+			OutAddresses[Index] = Resolve(Keys[Index]);
+		}
+	}
+
+	/** Object or class path has link with value */
+	bool IsPathDocumented(const FSoftObjectPath& Path) const { return DocumentedPaths.Contains(Path); }
+
+	int32 Num() const { return Links.Num(); }
+
+	/** Visit every key that has value */
+	void ForEachLink(TFunctionRef<void(const FString& Key, const FString& Value)> Visitor) const
+	{
+		for (const TPair<FString, FString>& Pair : Links)
+		{
+			Visitor(Pair.Key, Pair.Value);
+		}
+	}
+
+	/** Unique per built snapshot, zero for empty one. Use to invalidate data derived from links */
+	uint64 GetSerial() const { return Serial; }
+
+	/** Heap memory used by this snapshot */
+	SIZE_T GetAllocatedSize() const;
+
+	/** Copy link sources into new snapshot. Game thread only */
+	static TUniquePtr<FDocumentationLinkSnapshot> Build(const UDocumentationUtilities& Settings);
+
+	/**
+	 * Replace current snapshot. Old snapshot is deleted once all readers that could see it have left
+	 * Passing null publishes empty snapshot
+	 * Must not be called while the calling thread holds FDocumentationLinkReadScope
+	 */
+	static void Publish(TUniquePtr<FDocumentationLinkSnapshot> Snapshot);
+
+private:
+	/** Must match GetTypeHash(FString), keys are case insensitive */
+	static uint32 HashKey(FStringView Key) { return FCrc::Strihash_DEPRECATED(Key.Len(), Key.GetData()); }
+
+	TMap<FString, FString> Links;
+	TSet<FSoftObjectPath> DocumentedPaths;
+	uint64 Serial = 0;
+
+	friend class FDocumentationLinkReadScope;
+};
+
+/**
+ * Read access to current link snapshot
+ * Entering and leaving the scope is wait-free, publisher waits for readers instead
+ * Keep scopes short: snapshot will not be released while any scope is open
+ */
+class DOCUMENTATIONUTILITIESEDITOR_API FDocumentationLinkReadScope
+{
+public:
+	FDocumentationLinkReadScope();
+	~FDocumentationLinkReadScope();
+
+	UE_NONCOPYABLE(FDocumentationLinkReadScope);
+
+	const FDocumentationLinkSnapshot& Get() const { return *Snapshot; }
+	const FDocumentationLinkSnapshot* operator->() const { return Snapshot; }
+	const FDocumentationLinkSnapshot& operator*() const { return *Snapshot; }
+
+private:
+	const FDocumentationLinkSnapshot* Snapshot;
+	uint32 ReaderSlot;
+};
@@ -0,0 +1,38 @@
+// Copyright (C) Vasily Bulgakov. 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "DocumentationLinksLibrary.generated.h"
+
+/**
+ * Editor scripting access to documentation links, callable from Editor Utility Blueprints and Python
+ * Batch functions edit 'Links' in settings with one transaction, one snapshot rebuild and one config write
+ */
+UCLASS()
+class DOCUMENTATIONUTILITIESEDITOR_API UDocumentationLinksLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Add or update links, key to address. Returns number of changed entries */
+	UFUNCTION(BlueprintCallable, Category = "Documentation|Links", meta = (AdvancedDisplay = "bSaveConfig"))
+	static int32 SetLinks(const TMap<FString, FString>& Links, bool bSaveConfig = true);
+
+	/** Remove links by key. Returns number of removed entries */
+	UFUNCTION(BlueprintCallable, Category = "Documentation|Links", meta = (AdvancedDisplay = "bSaveConfig"))
+	static int32 RemoveLinks(const TArray<FString>& Keys, bool bSaveConfig = true);
+
+	/** Set and remove in one batch. Returns number of changed entries */
+	UFUNCTION(BlueprintCallable, Category = "Documentation|Links", meta = (AdvancedDisplay = "bSaveConfig"))
+	static int32 EditLinks(const TMap<FString, FString>& LinksToSet, const TArray<FString>& LinksToRemove, bool bSaveConfig = true);
+
+	/** Entries of 'Links' in settings, key to address */
+	UFUNCTION(BlueprintCallable, Category = "Documentation|Links")
+	static TMap<FString, FString> GetLinks();
+
+	/** Address after all sources and redirects, or key itself if it has no link */
+	UFUNCTION(BlueprintCallable, Category = "Documentation|Links")
+	static FString ResolveLink(const FString& Key);
+};
@@ -8,10 +8,13 @@
 class IDocumentationUtilitiesEditorModule : public IModuleInterface
 {
 public:
-	/**  */
+	/** Resolve link and open it using scheme from FDocumentationLinkSchemes */
 	static void OpenLink(FString Link);
 
-	/** Check link can result in action */
+	/** Resolve link and let its scheme prepare for opening, for example start loading asset. Call on hover */
+	static void PrefetchLink(FString Link);
+
+	/** Check link can result in action. Resolved address must have registered scheme */
 	static bool IsLinkValid(FString Link);
 };
 
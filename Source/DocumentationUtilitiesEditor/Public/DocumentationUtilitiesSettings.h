@@ -8,6 +8,9 @@
 #include <Engine/DataAsset.h>
 #include "DocumentationUtilitiesSettings.generated.h"
 
+class FDocumentationLinkReadScope;
+struct FStreamableHandle;
+
 
 /** */
 UENUM()
@@ -17,6 +20,7 @@ enum class EDocumentationLinkType : uint8
 	Asset,
 	Class,
 	Native UMETA(Hidden),
+	AssetHint UMETA(Hidden),
 	MAX UMETA(Hidden)
 };
 
@@ -56,27 +60,39 @@ public:
 		case EDocumentationLinkType::Class: return ClassKey.ToString();
 		case EDocumentationLinkType::String: break;
 		case EDocumentationLinkType::Native: break;		
+		case EDocumentationLinkType::AssetHint: break;
 		}
 		return StringKey;
 	}
 
 	bool IsValid() const 
 	{ 		
-		if (!Value.IsEmpty())
+		return HasValue() && HasKey();
+	}
+
+	bool HasKey() const
+	{
+		switch (Type)
 		{		
-			switch (Type)
-			{		
-			case EDocumentationLinkType::Asset: return !AssetKey.IsNull();
-			case EDocumentationLinkType::Class: return !ClassKey.IsNull();
-			case EDocumentationLinkType::String: return !StringKey.IsEmpty();
-			case EDocumentationLinkType::Native: return !StringKey.IsEmpty();		
-			}
+		case EDocumentationLinkType::Asset: return !AssetKey.IsNull();
+		case EDocumentationLinkType::Class: return !ClassKey.IsNull();
+		case EDocumentationLinkType::String: return !StringKey.IsEmpty();
+		case EDocumentationLinkType::Native: return !StringKey.IsEmpty();		
+		case EDocumentationLinkType::AssetHint: return !StringKey.IsEmpty();
 		}
-		return false;		
+		return false;
 	}
 
 	bool HasValue() const { return !Value.IsEmpty(); }
 
+	/** Heap memory of strings owned by link */
+	SIZE_T GetAllocatedSize() const
+	{
+		return StringKey.GetAllocatedSize() + Value.GetAllocatedSize()
+			+ AssetKey.ToSoftObjectPath().GetSubPathString().GetAllocatedSize()
+			+ ClassKey.ToSoftObjectPath().GetSubPathString().GetAllocatedSize();
+	}
+
 
 	bool ExportTextItem(FString& ValueStr, FDocumentationHintLink const& DefaultValue, UObject* Parent, int32 PortFlags, UObject* ExportRootScope) const;
 	bool ImportTextItem(const TCHAR*& Buffer, int32 PortFlags, UObject* Parent, FOutputDevice* ErrorText);
@@ -94,6 +110,28 @@ struct TStructOpsTypeTraits< FDocumentationHintLink > : public TStructOpsTypeTra
 
 
 
+/**
+ * Set of documentation links owned by a team or plugin
+ * Register in documentation settings 'Link Tables', tables are loaded in background after engine init
+ */
+UCLASS(BlueprintType)
+class DOCUMENTATIONUTILITIESEDITOR_API UDocumentationLinkTableAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, Category = "Links")
+	TArray<FDocumentationHintLink> Links;
+
+public:
+	/** Tables only feed editor link resolution, runtime uses cooked FDocumentationLinkTable */
+	virtual bool IsEditorOnly() const override { return true; }
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	virtual void PostEditUndo() override;
+};
+
+
+
 /**
  * Additional settings for documentation links
  * 
@@ -107,6 +145,20 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Documentation", meta = (HideChildren))
 	FHintStruct Hint = FHintStruct().Hint(EHintSource::ClassTooltip).Link(TEXT("https://github.com/Bargestt/DocumentationUtilities/wiki"));
 
+	/** 
+	 * Display hints and tooltips as Markdown
+	 * Supports **bold**, *italic*, `code`, [text](link), # headings and - lists
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Documentation")
+	bool bMarkdownHints;
+
+	/** 
+	 * Local copy of documentation pages used for link preview tooltips, relative to project directory
+	 * URL path maps to file: https://site/guide/actors -> guide/actors.md, .html or guide/actors/index.*
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Documentation", meta = (RelativeToGameDir))
+	FDirectoryPath DocsPreviewDirectory;
+
 
 	/** 
 	 * Documentation links in content browser
@@ -124,6 +176,10 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Documentation: Content Browser")
 	bool bShowUndocumentedLinks;
 
+	/** Display documentation icon on asset tiles that have Asset or Class link */
+	UPROPERTY(config, EditAnywhere, Category = "Documentation: Content Browser")
+	bool bShowContentBrowserBadges;
+
 	/** Format string of how the Action will be displayed in context menu. Use arg {0} to display asset name */
 	UPROPERTY(EditAnywhere, Category = "Documentation: Content Browser")
 	FString ClassDocumentationLink;
@@ -141,6 +197,9 @@ public:
 	UPROPERTY(config, EditAnywhere, Category = "Documentation: Links Picker", meta = (DisplayName = "Show Native"))
 	bool bLinksPicker_ShowNative;
 
+	UPROPERTY(config, EditAnywhere, Category = "Documentation: Links Picker", meta = (DisplayName = "Show Asset Hints"))
+	bool bLinksPicker_ShowAssetHints;
+
 	UPROPERTY(config, EditAnywhere, Category = "Documentation: Links Picker", meta = (DisplayName = "Show String"))
 	bool bLinksPicker_ShowString;
 
@@ -158,10 +217,18 @@ public:
 	 * 
 	 * Start Link with 'http' or 'https' to open URL in your web browser
 	 * Start Link with '/' to open asset editor for the Path specified, add prefix 'Edit:' to open in edit mode
+	 * Other modules can add schemes, for example 'ticket:', through FDocumentationLinkSchemes
 	 */
 	UPROPERTY(EditAnywhere, Category = "Documentation: Links", meta = (HideChildren))
 	FHintStruct LinksHint = FHintStruct().Hint(EHintSource::PropertyTooltip).Tooltip(EHintSource::PropertyTooltip);
 
+	/** 
+	 * Index native headers in background to support 'source:' links 
+	 * Example: source:/Script/Engine.Actor opens Actor.h at class declaration
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Documentation: Links", meta = (ConfigRestartRequired = true))
+	bool bIndexSourceFiles;
+
 	/** Collect Links from native classes */
 	UPROPERTY(config, EditAnywhere, Category = "Documentation: Links", meta = (ConfigRestartRequired = true))
 	bool bCollectNativeHints;
@@ -170,39 +237,148 @@ public:
 	UPROPERTY(config, EditAnywhere, Category = "Documentation: Links", meta = (EditCondition = bCollectNativeHints))
 	bool bRemoveOldNativeHints;
 
+	/** 
+	 * Collect Links from Blueprints and data assets using asset registry data
+	 * Assets are not loaded, keys are read from FHintStruct searchable names
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Documentation: Links", meta = (ConfigRestartRequired = true))
+	bool bCollectAssetHints;
+
+	/** Remove Asset Hint links if they were not found during init */
+	UPROPERTY(config, EditAnywhere, Category = "Documentation: Links", meta = (EditCondition = bCollectAssetHints))
+	bool bRemoveOldAssetHints;
+
+	/** 
+	 * Write resolved links to Content/DocumentationUtilities/LinkTable.bin when cooking
+	 * Packaged game can look them up with FDocumentationLinkTable. Enabling adds the directory to staged non-UFS files
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Documentation: Links")
+	bool bCookRuntimeLinkTable;
+
 	UPROPERTY(config, EditAnywhere, EditFixedSize, Category = "Documentation: Links")
 	TArray<FDocumentationHintLink> NativeLinks;
 
+	/** Addresses declared with DOCUMENTATION_NATIVE_LINK. Never saved, value of NativeLinks entry takes priority */
+	UPROPERTY(Transient)
+	TArray<FDocumentationHintLink> RegisteredNativeLinks;
+
+	UPROPERTY(config, EditAnywhere, EditFixedSize, Category = "Documentation: Links")
+	TArray<FDocumentationHintLink> AssetHintLinks;
+
 	UPROPERTY(config, EditAnywhere, Category = "Documentation: Links")
 	TArray<FDocumentationHintLink> Links;
 
+	/** 
+	 * Link tables loaded asynchronously after engine init, merged as they arrive
+	 * Used after Links and before LinksOverride, earlier tables take priority
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Documentation: Links")
+	TArray<TSoftObjectPtr<UDocumentationLinkTableAsset>> LinkTables;
+
 	/** Config based option takes priority over others */
 	//UPROPERTY(config)
 	UPROPERTY(config, EditAnywhere, Category = "Documentation: Links")
 	TArray<FDocumentationHintLink> LinksOverride;
 
+private:
+	/** Slot per LinkTables entry, null until loaded */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UDocumentationLinkTableAsset>> LoadedLinkTables;
+
+	TArray<TSharedPtr<FStreamableHandle>> LinkTableHandles;
+
+	/** Callbacks of previous LoadLinkTables are ignored */
+	int32 LinkTablesGeneration = 0;
+
+	void OnLinkTableLoaded(int32 Index, int32 Generation);
 
 public:
 	UDocumentationUtilities(const FObjectInitializer& ObjectInitializer);
 	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
 	virtual void PostInitProperties() override;
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	virtual void PostEditUndo() override;
+	virtual void PostReloadConfig(FProperty* PropertyThatWasLoaded) override;
+
+	/** Fill AssetHintLinks from asset registry. Requires asset registry to finish initial scan */
+	void CollectAssetHints();
+
+	/** Replace NativeLinks with found keys and registered links, keeping values of existing ones */
+	void SetNativeLinkKeys(const TSet<FString>& LinkKeys);
+
+	/** Request async load of LinkTables. Links of each table are used as soon as it is loaded */
+	void LoadLinkTables();
+
+	/** True if table is loaded as one of LinkTables */
+	bool IsLinkTableLoaded(const UDocumentationLinkTableAsset* Table) const { return Table && LoadedLinkTables.Contains(Table); }
+
+	/** Slot per LinkTables entry, null until loaded */
+	const TArray<TObjectPtr<UDocumentationLinkTableAsset>>& GetLoadedLinkTables() const { return LoadedLinkTables; }
+
+	/** Fill RegisteredNativeLinks from DOCUMENTATION_NATIVE_LINK and add their keys to NativeLinks */
+	void MergeRegisteredNativeLinks();
+
+	/** 
+	 * Set and remove many entries of Links in one undo transaction, with one snapshot rebuild and one config write
+	 * Existing entry with the same key is updated, new keys are added as String links
+	 * Returns number of entries added, changed or removed
+	 */
+	int32 EditLinks(const TMap<FString, FString>& LinksToSet, const TArray<FString>& LinksToRemove, bool bSaveConfig = true);
+
+	/** 
+	 * Native links are collected over several frames after engine init
+	 * Call before reading NativeLinks to finish collection immediately. Game thread only
+	 */
+	static void EnsureNativeLinksCollected();
+
+	/**
+	 * LinkTables are loaded asynchronously
+	 * Call before reading snapshot for cook or export to wait for pending loads. Game thread only
+	 */
+	static void EnsureLinkTablesLoaded();
 
 public:
+	/** Find entry in settings arrays. Game thread only, pointer is invalidated by any settings change */
 	static const FDocumentationHintLink* FindLinkByKey(const FString& Link);
+
+	/** Thread safe, uses current FDocumentationLinkSnapshot */
 	static bool HasLinkRedirector(const FString& Link);
 	static FString ResolveLink(const FString& Link);
 
+	/** Append resolved address to OutAddress. Returns true if link was redirected */
+	static bool ResolveLink(FStringView Link, FStringBuilderBase& OutAddress);
+
+	/** 
+	 * Resolve many links under one snapshot without allocations
+	 * Results point into Snapshot or into Links and are valid while both are alive
+	 */
+	static void ResolveLinks(TConstArrayView<FStringView> Links, TArrayView<FStringView> OutAddresses, const FDocumentationLinkReadScope& Snapshot);
+
+	/** Key -> value of every entry of type. Keys without value are listed too, discovered hints get their value later */
 	TMap<FString, FString> CollectLinksOfType(EDocumentationLinkType Type) const;
 
+	/** Publish new FDocumentationLinkSnapshot after any of the sources has changed */
+	void RebuildLinkSnapshot();
+
 
 	TArray<const TArray<FDocumentationHintLink>*> GetSources() const
 	{
-		return TArray<const TArray<FDocumentationHintLink>*>(
+		TArray<const TArray<FDocumentationHintLink>*> Sources(
 		{
 			&NativeLinks,
-			&Links,
-			&LinksOverride
+			&RegisteredNativeLinks,
+			&AssetHintLinks,
+			&Links
 		});
+		for (const UDocumentationLinkTableAsset* Table : LoadedLinkTables)
+		{
+			if (Table)
+			{
+				Sources.Add(&Table->Links);
+			}
+		}
+		Sources.Add(&LinksOverride);
+		return Sources;
 	}
 };
 